@@ -0,0 +1,101 @@
+#include "../include/model/Algorithm.hpp"
+#include "../include/model/PluginRegistry.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// One library, several variants: the same LSD radix sort at different digit widths, exported through
+// raystructRegistry so the harness can sweep all of them after a single compile.
+template <int DigitBits>
+class RadixVariant : public Algorithm {
+public:
+    // Sorts a copy of the elements without printing.
+    void execute(DataStructure* ds) override {
+        std::vector<int> elements = ds->getElements();
+        sort(elements);
+    }
+
+    // Shows the array before and after the passes.
+    void executeAndDisplay(DataStructure* ds) override {
+        std::vector<int> elements = ds->getElements();
+        std::cout << "Before sorting: ";
+        display(elements);
+        sort(elements);
+        std::cout << "After sorting: ";
+        display(elements);
+    }
+
+    // Prints elements in a single line.
+    void display(const std::vector<int>& elements) override {
+        for (int value : elements) {
+            std::cout << value << ' ';
+        }
+        std::cout << std::endl;
+    }
+
+    // Names the variant by its digit width.
+    std::string getName() const override {
+        return "Radix Sort (" + std::to_string(DigitBits) + "-bit digits)";
+    }
+
+private:
+    // Sign-flipped keys, one counting pass and one scatter per digit.
+    void sort(std::vector<int>& elements) {
+        constexpr std::uint32_t radix = 1u << DigitBits;
+        constexpr std::uint32_t mask = radix - 1;
+        const std::size_t n = elements.size();
+        std::vector<std::uint32_t> keys(n);
+        std::vector<std::uint32_t> buffer(n);
+        std::vector<std::size_t> counts(radix);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            keys[i] = static_cast<std::uint32_t>(elements[i]) ^ 0x80000000u;
+        }
+        for (int shift = 0; shift < 32; shift += DigitBits) {
+            std::fill(counts.begin(), counts.end(), 0);
+            for (std::uint32_t key : keys) {
+                ++counts[(key >> shift) & mask];
+            }
+            std::size_t sum = 0;
+            for (std::size_t& count : counts) {
+                const std::size_t current = count;
+                count = sum;
+                sum += current;
+            }
+            for (std::uint32_t key : keys) {
+                buffer[counts[(key >> shift) & mask]++] = key;
+            }
+            keys.swap(buffer);
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            elements[i] = static_cast<int>(keys[i] ^ 0x80000000u);
+        }
+    }
+};
+
+// Factory for one digit width; converts to the plain function pointer the registry stores.
+template <int DigitBits>
+Algorithm* createVariant() {
+    return new RadixVariant<DigitBits>();
+}
+
+static const PluginParameter bits4[] = {{"digitBits", "4"}, {"passes", "8"}};
+static const PluginParameter bits8[] = {{"digitBits", "8"}, {"passes", "4"}};
+static const PluginParameter bits11[] = {{"digitBits", "11"}, {"passes", "3"}};
+static const PluginParameter bits16[] = {{"digitBits", "16"}, {"passes", "2"}};
+
+static const PluginAlgorithmEntry variants[] = {
+    {"Radix Sort 4", &createVariant<4>, bits4, 2},
+    {"Radix Sort 8", &createVariant<8>, bits8, 2},
+    {"Radix Sort 11", &createVariant<11>, bits11, 2},
+    {"Radix Sort 16", &createVariant<16>, bits16, 2},
+};
+
+static const PluginRegistry registry = {RAYSTRUCT_REGISTRY_VERSION, variants, 4, nullptr, 0};
+
+// Exported registry entry point expected by AlgorithmFactory.
+extern "C" const PluginRegistry* raystructRegistry() {
+    return &registry;
+}
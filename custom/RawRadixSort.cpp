@@ -0,0 +1,84 @@
+#include "../include/model/PluginAbi.hpp"
+#include <stdint.h>
+#include <string.h>
+
+// Raw-buffer plugin: the harness hands over a pointer to packed 32-bit keys and a scratch arena, so
+// the kernel never copies through a DataStructure or allocates while it is being timed.
+
+// Start of the histograms in the arena: just past the key buffer, rounded up so the size_t counters stay
+// aligned when the keys end halfway through a word.
+static size_t histogramOffset(size_t length, size_t elementWidth) {
+    return (length * elementWidth + alignof(size_t) - 1) / alignof(size_t) * alignof(size_t);
+}
+
+// Byte-wise LSD radix sort needs a second key buffer and one histogram per byte.
+static size_t radixScratchBytes(size_t length, size_t elementWidth) {
+    return histogramOffset(length, elementWidth) + 4 * 256 * sizeof(size_t);
+}
+
+// Sorts signed 32-bit keys with four 8-bit passes, skipping passes where every key shares the digit.
+static int radixRun(const RaystructCall* call) {
+    if (call->operation != RAYSTRUCT_OP_SORT || call->element_width != sizeof(uint32_t)) {
+        return 1;
+    }
+    if (call->length < 2) {
+        return 0;
+    }
+
+    const size_t n = call->length;
+    uint32_t* keys = (uint32_t*)call->data;
+    uint32_t* buffer = (uint32_t*)call->scratch;
+    size_t* histograms = (size_t*)((char*)call->scratch + histogramOffset(n, sizeof(uint32_t)));
+    memset(histograms, 0, 4 * 256 * sizeof(size_t));
+
+    // Flip the sign bit so signed order matches unsigned order, counting all digits in one read
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t key = keys[i] ^ 0x80000000u;
+        keys[i] = key;
+        for (int p = 0; p < 4; ++p) {
+            ++histograms[p * 256 + ((key >> (8 * p)) & 0xFF)];
+        }
+    }
+
+    uint32_t* src = keys;
+    uint32_t* dst = buffer;
+    for (int p = 0; p < 4; ++p) {
+        size_t* histogram = histograms + p * 256;
+        if (histogram[(src[0] >> (8 * p)) & 0xFF] == n) {
+            continue;
+        }
+
+        size_t sum = 0;
+        for (int d = 0; d < 256; ++d) {
+            size_t count = histogram[d];
+            histogram[d] = sum;
+            sum += count;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t key = src[i];
+            dst[histogram[(key >> (8 * p)) & 0xFF]++] = key;
+        }
+        uint32_t* swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = src[i] ^ 0x80000000u;
+    }
+    return 0;
+}
+
+static const RaystructPluginInfo radixInfo = {
+    RAYSTRUCT_PLUGIN_ABI_VERSION,
+    sizeof(RaystructPluginInfo),
+    "Raw Radix Sort",
+    RAYSTRUCT_CAP_SORT | RAYSTRUCT_CAP_INT32,
+    radixScratchBytes,
+    radixRun
+};
+
+// Exported entry point; AlgorithmFactory looks for it before createAlgorithm.
+extern "C" const RaystructPluginInfo* raystruct_plugin_v1(void) {
+    return &radixInfo;
+}
@@ -1,19 +1,45 @@
 // include/algorithm/AlgorithmFactory.hpp
 #pragma once
 #include <string>
+#include <vector>
 #include "../core/Enums.hpp"
 #include "../model/Algorithm.hpp"
+#include "../model/PluginRegistry.hpp"
 #include "InsertionSort.hpp"
 #include "MergeSort.hpp"
 #include "HeapBuild.hpp"
 #include "HeapSelection.hpp"
+#include "QuickSelect.hpp"
+#include "SimdSelection.hpp"
+#include "StreamingSelection.hpp"
+#include "ParallelSelection.hpp"
+#include "ExternalMergeSort.hpp"
+#include "KWayMerge.hpp"
 #include "AStar.hpp"
 #include "Prims.hpp"
+#include "SimdSort.hpp"
+#include "LsdRadixSort.hpp"
+#include "StdSort.hpp"
+#include "PdqSort.hpp"
+#include "SortingNetworkSort.hpp"
+#include "RawBufferAlgorithm.hpp"
 
 class AlgorithmFactory {
 public:
-    // Instantiates built-in algorithms or loads a custom shared library when requested.
+    // Instantiates built-in algorithms or loads a custom shared library when requested. A library exporting
+    // RAYSTRUCT_PLUGIN_ENTRY is wrapped in a RawBufferAlgorithm; otherwise createAlgorithm is used, or the
+    // first registry entry when the library only exports a registry.
     static Algorithm* createAlgorithm(AlgorithmEnum type, const std::string& customLibraryPath = "");
+    // Creates the algorithm a library registered under entryName; null when there is no such entry.
+    static Algorithm* createCustomAlgorithm(const std::string& customLibraryPath, const std::string& entryName);
+    // Lists the algorithms a library registers (empty for single-factory libraries); false when it cannot be loaded.
+    static bool listCustomAlgorithms(const std::string& customLibraryPath, std::vector<RegisteredEntry>& entries);
+    // True while the library is open in the factory, e.g. because the interactive session selected it.
+    static bool isCustomLibraryLoaded(const std::string& customLibraryPath);
+    // Unloads one custom library so it can be rebuilt in place; every algorithm it created must already be
+    // deleted. keepFile leaves an owned build on disk so it can be loaded again. Returns false when the
+    // library was not loaded.
+    static bool unloadCustomLibrary(const std::string& customLibraryPath, bool keepFile = false);
     // Clears all previously loaded custom algorithm libraries.
     static void cleanupCustomLibraries();
 };
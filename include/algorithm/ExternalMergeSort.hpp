@@ -0,0 +1,88 @@
+// include/algorithm/ExternalMergeSort.hpp
+#pragma once
+#include "../model/Algorithm.hpp"
+#include "../core/Enums.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ExternalMergeSort : public Algorithm {
+public:
+    // Where the unsorted keys come from
+    enum class Source {
+        STRUCTURE,
+        FILE
+    };
+
+private:
+    // Pipeline parameters
+    Source source = Source::STRUCTURE;
+    std::string inputPath;
+    std::string outputPath;
+    std::string tempDirectory;
+    std::size_t memoryBudget = std::size_t(64) << 20;
+    SimdLevel level;
+
+    // Statistics of the last run
+    std::size_t elementsSorted = 0;
+    std::size_t runCount = 0;
+    std::size_t mergePasses = 0;
+    std::uint64_t bytesRead = 0;
+    std::uint64_t bytesWritten = 0;
+    double runSeconds = 0.0;
+    double mergeSeconds = 0.0;
+    bool lastRunValid = false;
+
+    // Budget expressed in keys (never below the minimum the pipeline needs).
+    std::size_t budgetElements() const;
+    // Path of a scratch file in the temp directory, unique to this run.
+    std::string scratchPath(const std::string& tag, std::size_t index) const;
+    // Reads budget-sized chunks, sorts each in memory and spills it; returns the run files.
+    std::vector<std::string> generateRuns(DataStructure* ds, const std::string& destination);
+    // Merges runs into destination, in several passes when there are more runs than the budget can buffer.
+    void mergeRuns(std::vector<std::string> runs, const std::string& destination);
+    // Runs both phases into destination and records the statistics; throws std::runtime_error when a read
+    // or write fails (for example on a full disk), after removing its scratch files.
+    void sortToFile(DataStructure* ds, const std::string& destination);
+
+public:
+    // Picks the widest instruction set the running CPU supports for the in-memory runs.
+    ExternalMergeSort();
+
+    // Overrides from Algorithm
+    // Sorts the source into the output file without printing; I/O errors throw std::runtime_error, and a
+    // scratch output is removed first.
+    void execute(DataStructure* ds) override;
+    // Sorts the source and prints phase times and I/O volume, or that the run failed.
+    void executeAndDisplay(DataStructure* ds) override;
+    // Prints the statistics of the last run.
+    void display(const std::vector<int>& elements) override;
+    // Returns the algorithm name with source and memory budget.
+    std::string getName() const override;
+
+    // Setters for parameters
+    // Sorts the elements of the benchmarked structure (the default).
+    void useStructure();
+    // Sorts a raw file of native-endian 32-bit integers.
+    void setInputFile(const std::string& path);
+    // Writes the sorted keys to path; when empty a scratch file is used and removed after the run.
+    void setOutputFile(const std::string& path);
+    // Directory for run files; defaults to the system temp directory.
+    void setTempDirectory(const std::string& path);
+    // Memory the pipeline may use, in bytes: half for a run and half for the in-memory sort's scratch during
+    // run generation, and all of it for read-ahead and output buffers while merging.
+    void setMemoryBudget(std::size_t bytes);
+
+    // Statistics of the last run
+    // Keys written to the output.
+    std::size_t getElementsSorted() const;
+    // Sorted runs spilled during run generation.
+    std::size_t getRunCount() const;
+    // Merge passes over the data (0 when everything fit in one run).
+    std::size_t getMergePasses() const;
+    // Bytes read from the input and from run files.
+    std::uint64_t getBytesRead() const;
+    // Bytes written to run files and to the output.
+    std::uint64_t getBytesWritten() const;
+};
@@ -1,16 +1,40 @@
 // include/algorithm/HeapBuild.hpp
 #pragma once
 #include "../model/Algorithm.hpp"
+#include <cstddef>
 
 class HeapBuild : public Algorithm {
+public:
+    // Strategies for turning an array into a heap
+    enum class Engine {
+        RECURSIVE,
+        ITERATIVE,
+        BOTTOM_UP,
+        QUATERNARY,
+        OCTONARY
+    };
+
 protected:
     bool isMinHeap;
+    Engine engine = Engine::RECURSIVE;
+    // Element comparisons performed by the last build.
+    std::size_t comparisons = 0;
+    // Input copied by prepare() for the d-ary engines, and the buffer they build in; heap + 1 starts a
+    // cache line of storage
+    std::vector<int> input;
+    std::vector<int> storage;
+    int* heap = nullptr;
+    bool prepared = false;
 
     // Helper functions for heap operations
     // Restores the heap property for the subtree rooted at index i.
     void heapify(std::vector<int>& elements, int n, int i, bool isMinHeap);
-    // Builds a heap without printing intermediate states.
+    // Builds a heap with the selected engine without printing intermediate states.
     void buildHeap(std::vector<int>& elements, bool isMinHeap);
+    // Sizes storage for n elements and points heap at its aligned start.
+    void alignStorage(std::size_t n);
+    // Builds data[0, n) in place with the selected non-recursive engine.
+    void buildInPlace(int* data, std::size_t n, bool isMinHeap);
     // Builds a heap while displaying each step.
     void buildHeapVisual(std::vector<int>& elements, bool isMinHeap);
     // Renders the array as a tree-like structure.
@@ -18,6 +42,8 @@ protected:
 
 public:
     // Overrides from Algorithm
+    // Copies the input into aligned storage for the d-ary engines, so the timed run only restores it.
+    void prepare(DataStructure* ds) override;
     // Performs the heap build silently.
     void execute(DataStructure* ds) override;
     // Performs the heap build with visual output.
@@ -28,4 +54,14 @@ public:
     // Setter for heap type
     // Chooses between min-heap (true) or max-heap (false).
     void setHeapType(bool type);
+
+    // Chooses the build engine; the d-ary engines store children of i at d*i+1 .. d*i+d. Takes effect on
+    // the next prepare().
+    void setEngine(Engine choice);
+    // Number of children per node for the selected engine.
+    std::size_t getArity() const;
+    // Returns the comparison count of the last build.
+    std::size_t getComparisons() const;
+    // Builds the same input with every engine and prints time and comparisons next to the recursive baseline.
+    void compareEngines(DataStructure* ds);
 };
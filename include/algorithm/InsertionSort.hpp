@@ -1,9 +1,35 @@
 // include/algorithm/InsertionSort.hpp
 #pragma once
 #include "../model/Algorithm.hpp"
+#include <cstddef>
 
 class InsertionSort : public Algorithm {
+public:
+    // Insertion kernels that can be measured in isolation
+    enum class Variant {
+        LINEAR,
+        BINARY,
+        BRANCHLESS,
+        NETWORK
+    };
+
 private:
+    // Insertion sort parameters
+    Variant variant = Variant::LINEAR;
+    std::size_t repetitions = 1;
+
+    // Helpers for the insertion kernels
+    // Classic scan from the right, shifting one element at a time.
+    void linearInsertionSort(std::vector<int>& elements);
+    // Binary search for the insertion point, then one memmove per element.
+    void binaryInsertionSort(std::vector<int>& elements);
+    // Finds the insertion point by counting smaller keys, with no data-dependent branches.
+    void branchlessInsertionSort(std::vector<int>& elements);
+    // Unrolled sorting network for n <= SortingNetworks::kMaxSize, binary insertion above that.
+    void networkSort(std::vector<int>& elements);
+    // Runs the kernel selected by the current variant.
+    void sortElements(std::vector<int>& elements);
+
     // Overrides from Algorithm
     // Prints the array contents for visualization.
     void display(const std::vector<int>& elements) override;
@@ -16,4 +42,12 @@ public:
     void executeAndDisplay(DataStructure* ds) override;
     // Returns the algorithm name for menus/output.
     std::string getName() const override;
+    // Reports how many times execute() sorts the input.
+    std::size_t getRepetitions() const override;
+
+    // Setters for parameters
+    // Chooses which insertion kernel is run.
+    void setVariant(Variant choice);
+    // Sorts a fresh copy of the input this many times per execute() so tiny inputs can be timed.
+    void setRepetitions(std::size_t count);
 };
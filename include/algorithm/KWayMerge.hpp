@@ -0,0 +1,54 @@
+// include/algorithm/KWayMerge.hpp
+#pragma once
+#include "../model/Algorithm.hpp"
+#include <cstddef>
+#include <vector>
+
+class KWayMerge : public Algorithm {
+public:
+    // How the runs are combined
+    enum class Engine {
+        LOSER_TREE,
+        HEAP,
+        PAIRWISE
+    };
+
+private:
+    // Merge parameters
+    Engine engine = Engine::LOSER_TREE;
+    std::size_t ways = 16;
+
+    // Runs built by prepare(): run r is runs[offsets[r], offsets[r + 1])
+    std::vector<int> runs;
+    std::vector<std::size_t> offsets;
+    std::vector<int> output;
+    std::vector<int> scratch;
+    bool prepared = false;
+
+    // Merges the prepared runs into output with the given engine.
+    void mergeWith(Engine choice);
+    // Passes the engine makes over the whole data set.
+    std::size_t passesFor(Engine choice) const;
+
+public:
+    // Overrides from Algorithm
+    // Splits the structure's elements into ways runs and sorts each one (untimed).
+    void prepare(DataStructure* ds) override;
+    // Merges the prepared runs, preparing them first if needed.
+    void execute(DataStructure* ds) override;
+    // Merges the runs, prints small outputs and compares the engines.
+    void executeAndDisplay(DataStructure* ds) override;
+    // Prints the array on a single line.
+    void display(const std::vector<int>& elements) override;
+    // Returns the algorithm name with engine and fan-in.
+    std::string getName() const override;
+
+    // Setters for parameters
+    // Chooses the merge engine.
+    void setEngine(Engine choice);
+    // Sets how many runs prepare() builds (at least one); takes effect on the next prepare().
+    void setWays(std::size_t count);
+
+    // Output of the last merge.
+    const std::vector<int>& getOutput() const;
+};
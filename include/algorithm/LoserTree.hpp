@@ -0,0 +1,63 @@
+// include/algorithm/LoserTree.hpp
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Tournament tree of losers for k-way merging. Every internal node keeps the loser of the match played
+// there and the root slot keeps the overall winner, so replacing the winner replays a single leaf-to-root
+// path of log2(k) comparisons with no sibling lookups. Ties go to the lower leaf, which keeps merges stable.
+class LoserTree {
+public:
+    // A sorted run [begin, end) of keys in memory.
+    struct Run {
+        const int* begin;
+        const int* end;
+    };
+
+private:
+    // Key in the high half (sign flipped so unsigned order matches int order), leaf index in the low half.
+    using Entry = std::uint64_t;
+    // Sorts after every real entry; marks leaves whose run has ended.
+    static constexpr Entry kExhausted = ~Entry(0);
+
+    std::size_t leafCount;
+    std::size_t capacity;
+    // First entry of each leaf, consumed by build().
+    std::vector<Entry> leaves;
+    // nodes[0] is the winner, nodes[1..capacity) the losers of each match.
+    std::vector<Entry> nodes;
+
+    // Packs a key and its leaf into one comparable entry.
+    static Entry encode(int key, std::size_t leaf);
+    // Plays the path from leaf to the root with the leaf's new entry.
+    void replay(std::size_t leaf, Entry entry);
+
+public:
+    // Creates a tree with the given number of leaves; all start exhausted.
+    explicit LoserTree(std::size_t ways);
+
+    // Number of leaves.
+    std::size_t ways() const;
+
+    // Sets the first key of a leaf; call build() once every leaf is set.
+    void setLeaf(std::size_t leaf, int key);
+    // Marks a leaf as having no keys.
+    void retireLeaf(std::size_t leaf);
+    // Plays every match bottom-up once the leaves hold their first keys.
+    void build();
+
+    // True once every leaf is exhausted.
+    bool empty() const;
+    // Leaf holding the smallest key.
+    std::size_t winner() const;
+    // The smallest key.
+    int winnerKey() const;
+    // Gives the winning leaf its next key.
+    void replaceWinner(int key);
+    // Marks the winning leaf as exhausted.
+    void retireWinner();
+
+    // Merges sorted in-memory runs into out, which must hold the sum of their lengths.
+    static void merge(const std::vector<Run>& runs, int* out);
+};
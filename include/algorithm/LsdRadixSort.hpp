@@ -0,0 +1,41 @@
+// include/algorithm/LsdRadixSort.hpp
+#pragma once
+#include "../model/Algorithm.hpp"
+#include <cstdint>
+
+class LsdRadixSort : public Algorithm {
+private:
+    // Radix sort parameters
+    int digitBits = 8;
+    unsigned threadCount = 1;
+
+    // Helpers for the digit passes
+    // Single-threaded passes over sign-flipped keys using one ping-pong buffer.
+    void sortSerial(std::vector<int>& elements);
+    // Same passes with per-task histograms and scatter ranges, run on the context's thread pool.
+    void sortParallel(std::vector<int>& elements, unsigned threads);
+    // Prints the array contents.
+    void display(const std::vector<int>& elements) override;
+
+public:
+    // Overrides from Algorithm
+    // Executes the radix sort without printing.
+    void execute(DataStructure* ds) override;
+    // Executes the radix sort and prints the array before and after.
+    void executeAndDisplay(DataStructure* ds) override;
+    // Returns the algorithm name with digit width and thread count.
+    std::string getName() const override;
+    // Splits the digit passes into tasks on the context's thread pool.
+    bool isParallel() const override;
+    // Current task count.
+    unsigned getThreadCount() const override;
+
+    // Sorts the vector in place; exposed so other engines can reuse the kernel.
+    void sort(std::vector<int>& elements);
+
+    // Setters for parameters
+    // Chooses 8-bit (4 passes) or 11-bit (3 passes) digits; other values are ignored.
+    void setDigitBits(int bits);
+    // Sets how many threads share each pass (1 runs the serial kernel).
+    void setThreadCount(unsigned threads) override;
+};
@@ -3,7 +3,18 @@
 #include "../model/Algorithm.hpp"
 
 class MergeSort : public Algorithm {
+public:
+    // Which merge strategy sorts the elements
+    enum class Variant {
+        TWO_WAY,
+        MULTIWAY
+    };
+
 private:
+    // Merge sort parameters
+    Variant variant = Variant::TWO_WAY;
+    std::size_t ways = 16;
+
     // Helpers for merge sort
     // Standard recursive merge sort implementation.
     void mergeSort(std::vector<int>& elements, int left, int right);
@@ -13,6 +24,10 @@ private:
     void merge(std::vector<int>& elements, int left, int mid, int right);
     // Merge step that displays after each write.
     void mergeVisual(std::vector<int>& elements, int left, int mid, int right);
+    // Sorts data[0, n) into target (data itself or buffer) by merging up to ways sorted slices per level.
+    void multiwaySort(int* data, int* buffer, std::size_t n, bool intoBuffer);
+    // Runs the kernel for the selected variant.
+    void sortElements(std::vector<int>& elements);
     // Prints the array contents.
     void display(const std::vector<int>& elements) override;
     
@@ -24,4 +39,10 @@ public:
     void executeAndDisplay(DataStructure* ds) override;
     // Returns the algorithm's display name.
     std::string getName() const override;
+
+    // Setters for parameters
+    // Chooses between the classic two-way merge and the loser-tree multiway merge.
+    void setVariant(Variant choice);
+    // Sets the fan-in of the multiway variant (at least two).
+    void setWays(std::size_t count);
 };
@@ -0,0 +1,56 @@
+// include/algorithm/ParallelSelection.hpp
+#pragma once
+#include "../model/SelectionAlgorithm.hpp"
+#include "../core/Enums.hpp"
+
+class ParallelSelection : public SelectionAlgorithm {
+public:
+    // How the work is split across threads
+    enum class Strategy {
+        AUTO,
+        LOCAL_HEAPS,
+        SAMPLE_PIVOTS
+    };
+
+private:
+    // Parallel selection parameters
+    Strategy strategy = Strategy::AUTO;
+    unsigned threadCount = 1;
+    SimdLevel level;
+
+    // Strategy that select() resolves AUTO to for this input.
+    Strategy resolveStrategy(std::size_t n) const;
+    // Every thread keeps the k best of its slice; the per-thread sets are merged at the end.
+    int selectLocalHeaps(const std::vector<int>& elements, unsigned threads);
+    // A sorted sample brackets the target rank; threads count and copy out the band between the two pivots.
+    int selectSamplePivots(std::vector<int>& elements, unsigned threads);
+    // Runs the resolved strategy with the given number of threads.
+    int selectWithThreads(std::vector<int>& elements, unsigned threads);
+    // Times the selection for 1, 2, 4, ... threads up to threadCount and prints speedup and efficiency.
+    void printScaling(const std::vector<int>& elements);
+
+protected:
+    // Overrides from SelectionAlgorithm
+    // Runs the selection on threadCount threads.
+    int select(std::vector<int>& elements) override;
+
+public:
+    // Picks the widest instruction set the running CPU supports for the local filters.
+    ParallelSelection();
+
+    // Overrides from Algorithm
+    // Computes the statistic and prints the result followed by the scaling table.
+    void executeAndDisplay(DataStructure* ds) override;
+    // Returns the algorithm name with strategy and thread count.
+    std::string getName() const override;
+    // Splits the input into tasks on the context's thread pool.
+    bool isParallel() const override;
+    // Current task count.
+    unsigned getThreadCount() const override;
+
+    // Setters for parameters
+    // Chooses the work split; AUTO uses local heaps for small k and sample pivots otherwise.
+    void setStrategy(Strategy choice);
+    // Sets how many threads share the input (at least one).
+    void setThreadCount(unsigned threads) override;
+};
@@ -0,0 +1,22 @@
+// include/algorithm/PdqSort.hpp
+#pragma once
+#include "../model/Algorithm.hpp"
+
+class PdqSort : public Algorithm {
+private:
+    // Overrides from Algorithm
+    // Prints the array contents for visualization.
+    void display(const std::vector<int>& elements) override;
+
+public:
+    // Overrides from Algorithm
+    // Executes pattern-defeating quicksort without printing.
+    void execute(DataStructure* ds) override;
+    // Executes the sort and prints the array before and after.
+    void executeAndDisplay(DataStructure* ds) override;
+    // Returns the algorithm name for menus/output.
+    std::string getName() const override;
+
+    // Sorts the vector in place; exposed so hybrid engines can reuse the kernel.
+    static void sort(std::vector<int>& elements);
+};
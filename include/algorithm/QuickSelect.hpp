@@ -0,0 +1,35 @@
+// include/algorithm/QuickSelect.hpp
+#pragma once
+#include "../model/SelectionAlgorithm.hpp"
+#include <cstddef>
+
+class QuickSelect : public SelectionAlgorithm {
+public:
+    // Partition-based selection methods
+    enum class Method {
+        INTROSELECT,
+        FLOYD_RIVEST,
+        NTH_ELEMENT
+    };
+
+private:
+    Method method = Method::INTROSELECT;
+
+protected:
+    // Overrides from SelectionAlgorithm
+    // Maps k onto an ascending index and runs the selected method.
+    int select(std::vector<int>& elements) override;
+
+public:
+    // Overrides from Algorithm
+    // Returns the name of the selection method.
+    std::string getName() const override;
+
+    // Chooses which selection method runs.
+    void setMethod(Method choice);
+
+    // Reorders data so data[index] holds the value it would have after sorting; exposed for reuse by other engines.
+    static int introselect(int* data, std::size_t n, std::size_t index);
+    // Floyd-Rivest selection: recursion on a small sample brackets index before partitioning.
+    static int floydRivest(int* data, std::size_t n, std::size_t index);
+};
@@ -0,0 +1,83 @@
+// include/algorithm/RawBufferAlgorithm.hpp
+#pragma once
+#include "../model/Algorithm.hpp"
+#include "../model/PluginAbi.hpp"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Adapts a plugin exporting the raw-buffer ABI (PluginAbi.hpp) to the Algorithm interface.
+// prepare() packs the elements once into a host-owned buffer of the plugin's element width and
+// sizes the scratch arena, so the timed loop is only a memcpy of the input and a direct C call.
+class RawBufferAlgorithm : public Algorithm {
+private:
+    // Frees the 64-byte aligned arenas.
+    struct AlignedFree {
+        void operator()(unsigned char* block) const;
+    };
+    using AlignedBuffer = std::unique_ptr<unsigned char[], AlignedFree>;
+
+    // Descriptor owned by the loaded library
+    const RaystructPluginInfo* info;
+
+    // Input packed at the plugin's width, the copy run() works on, and the plugin's scratch arena
+    AlignedBuffer input;
+    AlignedBuffer working;
+    AlignedBuffer scratch;
+    std::size_t length = 0;
+    std::size_t elementWidth = 0;
+    std::size_t scratchBytes = 0;
+    bool prepared = false;
+
+    // Run parameters
+    std::size_t repetitions = 1;
+    unsigned threadCount = 1;
+    std::size_t selectionRank = 0;
+    int lastStatus = 0;
+
+    // Packs the elements and sizes the arenas.
+    void loadInput(const std::vector<int>& elements);
+    // Copies the pristine input into the working buffer and makes one call.
+    int runOnce();
+    // Prints the array on one line.
+    void display(const std::vector<int>& elements) override;
+
+public:
+    // The descriptor must already be validated with isUsable().
+    explicit RawBufferAlgorithm(const RaystructPluginInfo* pluginInfo);
+
+    // Overrides from Algorithm
+    // Packs the input and allocates scratch outside the timed region.
+    void prepare(DataStructure* ds) override;
+    // Calls the plugin getRepetitions() times on fresh copies of the input; throws std::runtime_error
+    // with the status code when a call fails.
+    void execute(DataStructure* ds) override;
+    // Makes one call and prints the input and result.
+    void executeAndDisplay(DataStructure* ds) override;
+    // Plugin name with the ABI version and repetition count.
+    std::string getName() const override;
+    // Calls made by one execute().
+    std::size_t getRepetitions() const override;
+    // True when the plugin declared RAYSTRUCT_CAP_PARALLEL.
+    bool isParallel() const override;
+    // Tasks the plugin is offered through the pool handle.
+    void setThreadCount(unsigned threads) override;
+    // Current task count.
+    unsigned getThreadCount() const override;
+
+    // Sets how many calls one execute() makes (at least one).
+    void setRepetitions(std::size_t count);
+    // Rank used when the plugin only selects; defaults to the median.
+    void setSelectionRank(std::size_t rank);
+    // Result of the last call, widened back to int.
+    std::vector<int> getOutput() const;
+    // Return code of the last call (0 on success).
+    int getLastStatus() const;
+    // Descriptor provided by the plugin.
+    const RaystructPluginInfo& getInfo() const;
+
+    // Checks version, struct size, entry points and that the plugin supports an operation and an
+    // integer width the host can feed it; on failure error says why.
+    static bool isUsable(const RaystructPluginInfo* pluginInfo, std::string& error);
+};
@@ -0,0 +1,31 @@
+// include/algorithm/SimdKernels.hpp
+#pragma once
+#include <cstddef>
+#include "../core/Enums.hpp"
+
+// Vectorized building blocks for 32-bit keys shared by the SIMD algorithms.
+// Every kernel takes the instruction set to use so callers can compare paths on the same input.
+class SimdKernels {
+public:
+    // Returns the widest instruction set supported by the running CPU.
+    static SimdLevel detectLevel();
+    // Lowers the requested level to what the running CPU actually supports.
+    static SimdLevel clampLevel(SimdLevel requested);
+    // Returns a printable name for the given level.
+    static const char* levelName(SimdLevel level);
+
+    // Largest block sortSmall can handle in registers at the given level.
+    static std::size_t smallSortCapacity(SimdLevel level);
+    // Sorts n <= smallSortCapacity(level) elements with an in-register sorting network and bitonic merge.
+    static void sortSmall(int* data, std::size_t n, SimdLevel level);
+    // Moves every element < pivot (<= pivot when inclusive) to the front, returning how many there are.
+    // The scratch buffer must hold at least n + 8 ints.
+    static std::size_t partition(int* data, std::size_t n, int pivot, bool inclusive, int* scratch, SimdLevel level);
+    // Copies every element > threshold (< threshold when above is false) to out, returning how many there are.
+    // out must hold at least n + 8 ints.
+    static std::size_t filter(const int* data, std::size_t n, int threshold, bool above, int* out, SimdLevel level);
+    // Quicksort driver built on the vectorized partition and small-block networks.
+    static void sort(int* data, std::size_t n, SimdLevel level);
+    // Quickselect on the vectorized partition: returns the value at ascending rank index, reordering data.
+    static int select(int* data, std::size_t n, std::size_t index, SimdLevel level);
+};
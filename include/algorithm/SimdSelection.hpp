@@ -0,0 +1,45 @@
+// include/algorithm/SimdSelection.hpp
+#pragma once
+#include "../model/SelectionAlgorithm.hpp"
+#include "../core/Enums.hpp"
+
+class SimdSelection : public SelectionAlgorithm {
+public:
+    // How the k-th element is found
+    enum class Mode {
+        QUICKSELECT,
+        TOP_K
+    };
+
+private:
+    Mode mode = Mode::QUICKSELECT;
+    // Instruction set used by the kernels, detected from the CPU at construction.
+    SimdLevel level;
+    // The k best elements of the last top-k run, best first.
+    std::vector<int> topK;
+
+    // Quickselect over the vectorized compress-store partition.
+    int selectPartition(std::vector<int>& elements);
+    // Streams the input through a vectorized threshold filter in front of a k-element heap.
+    int selectTopK(std::vector<int>& elements);
+
+protected:
+    // Overrides from SelectionAlgorithm
+    // Runs the selected mode.
+    int select(std::vector<int>& elements) override;
+
+public:
+    // Picks the widest instruction set the running CPU supports.
+    SimdSelection();
+
+    // Overrides from Algorithm
+    // Returns the algorithm name with mode and instruction set.
+    std::string getName() const override;
+
+    // Chooses between partition-based quickselect and the top-k filter.
+    void setMode(Mode choice);
+    // Forces a narrower instruction set; requests above what the CPU supports are clamped.
+    void setSimdLevel(SimdLevel requested);
+    // Returns the k best elements found by the last top-k run (empty in quickselect mode).
+    const std::vector<int>& getTopK() const;
+};
@@ -0,0 +1,31 @@
+// include/algorithm/SimdSort.hpp
+#pragma once
+#include "../model/Algorithm.hpp"
+#include "../core/Enums.hpp"
+
+class SimdSort : public Algorithm {
+private:
+    // Instruction set used by the kernels, detected from the CPU at construction.
+    SimdLevel level;
+
+    // Overrides from Algorithm
+    // Prints the array contents for visualization.
+    void display(const std::vector<int>& elements) override;
+
+public:
+    // Picks the widest instruction set the running CPU supports.
+    SimdSort();
+
+    // Overrides from Algorithm
+    // Executes the vectorized quicksort without printing.
+    void execute(DataStructure* ds) override;
+    // Executes the sort and prints the array before and after.
+    void executeAndDisplay(DataStructure* ds) override;
+    // Returns the algorithm name, including the active instruction set.
+    std::string getName() const override;
+
+    // Forces a narrower instruction set; requests above what the CPU supports are clamped.
+    void setSimdLevel(SimdLevel requested);
+    // Returns the instruction set that will be used.
+    SimdLevel getSimdLevel() const;
+};
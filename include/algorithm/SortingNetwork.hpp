@@ -0,0 +1,238 @@
+// include/algorithm/SortingNetwork.hpp
+#pragma once
+#include <array>
+#include <cstddef>
+#include <utility>
+
+// Compile-time sorting networks for up to 64 elements.
+
+// One compare-exchange of a sorting network: after it runs, data[a] <= data[b].
+struct Comparator {
+    unsigned char a;
+    unsigned char b;
+};
+
+// Batcher's odd-even merge sort schedule for N elements, generated at compile time.
+// The network is built for the next power of two and comparators touching indices >= N
+// are dropped, which is valid because those lanes would hold +infinity.
+template <std::size_t N>
+struct BatcherSchedule {
+    // Smallest power of two >= N.
+    static constexpr std::size_t paddedSize() {
+        std::size_t size = 1;
+        while (size < N) size <<= 1;
+        return size;
+    }
+
+    // Walks the schedule, calling emit(a, b) for every comparator that stays inside N.
+    template <typename Emit>
+    static constexpr void generate(Emit&& emit) {
+        const std::size_t n = paddedSize();
+        for (std::size_t p = 1; p < n; p += p) {
+            for (std::size_t k = p; k > 0; k /= 2) {
+                for (std::size_t j = k % p; j + k < n; j += k + k) {
+                    for (std::size_t i = 0; i < k && i + j + k < n; ++i) {
+                        if ((i + j) / (p + p) == (i + j + k) / (p + p) && i + j + k < N) {
+                            emit(i + j, i + j + k);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Number of comparators in the trimmed network.
+    static constexpr std::size_t count() {
+        std::size_t total = 0;
+        generate([&total](std::size_t, std::size_t) { ++total; });
+        return total;
+    }
+
+    // The comparator list itself.
+    static constexpr std::array<Comparator, count()> build() {
+        std::array<Comparator, count()> schedule{};
+        std::size_t next = 0;
+        generate([&schedule, &next](std::size_t a, std::size_t b) {
+            schedule[next++] = Comparator{static_cast<unsigned char>(a), static_cast<unsigned char>(b)};
+        });
+        return schedule;
+    }
+
+    static constexpr std::array<Comparator, count()> comparators = build();
+};
+
+// Schedule used for N elements: Batcher's network unless a smaller one is known.
+template <std::size_t N>
+struct NetworkSchedule {
+    static constexpr auto comparators = BatcherSchedule<N>::comparators;
+};
+
+// Optimal (n <= 10, 12) and best-known (n = 16) comparator counts, from Knuth TAOCP vol. 3
+// and Dobbelaere's list of smallest sorting networks. Each was checked with the 0-1 principle.
+template <>
+struct NetworkSchedule<2> {
+    static constexpr std::array<Comparator, 1> comparators = {{
+        {0, 1}
+    }};
+};
+
+template <>
+struct NetworkSchedule<3> {
+    static constexpr std::array<Comparator, 3> comparators = {{
+        {0, 2}, {0, 1}, {1, 2}
+    }};
+};
+
+template <>
+struct NetworkSchedule<4> {
+    static constexpr std::array<Comparator, 5> comparators = {{
+        {0, 1}, {2, 3}, {0, 2}, {1, 3}, {1, 2}
+    }};
+};
+
+template <>
+struct NetworkSchedule<5> {
+    static constexpr std::array<Comparator, 9> comparators = {{
+        {0, 3}, {1, 4}, {0, 2}, {1, 3}, {0, 1}, {2, 4}, {1, 2}, {3, 4}, {2, 3}
+    }};
+};
+
+template <>
+struct NetworkSchedule<6> {
+    static constexpr std::array<Comparator, 12> comparators = {{
+        {0, 5}, {1, 3}, {2, 4}, {1, 2}, {3, 4}, {0, 3}, {2, 5}, {0, 1}, {2, 3}, {4, 5}, {1, 2}, {3, 4}
+    }};
+};
+
+template <>
+struct NetworkSchedule<7> {
+    static constexpr std::array<Comparator, 16> comparators = {{
+        {0, 6}, {2, 3}, {4, 5}, {0, 2}, {1, 4}, {3, 6}, {0, 1}, {2, 5}, {3, 4}, {1, 2}, {4, 6}, {2, 3},
+        {4, 5}, {1, 2}, {3, 4}, {5, 6}
+    }};
+};
+
+template <>
+struct NetworkSchedule<8> {
+    static constexpr std::array<Comparator, 19> comparators = {{
+        {0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {0, 1}, {2, 3}, {4, 5}, {6, 7},
+        {2, 4}, {3, 5}, {1, 4}, {3, 6}, {1, 2}, {3, 4}, {5, 6}
+    }};
+};
+
+template <>
+struct NetworkSchedule<9> {
+    static constexpr std::array<Comparator, 25> comparators = {{
+        {0, 3}, {1, 7}, {2, 5}, {4, 8}, {0, 7}, {2, 4}, {3, 8}, {5, 6}, {0, 2}, {1, 3}, {4, 5}, {7, 8},
+        {1, 4}, {3, 6}, {5, 7}, {0, 1}, {2, 4}, {3, 5}, {6, 8}, {2, 3}, {4, 5}, {6, 7}, {1, 2}, {3, 4},
+        {5, 6}
+    }};
+};
+
+template <>
+struct NetworkSchedule<10> {
+    static constexpr std::array<Comparator, 29> comparators = {{
+        {0, 8}, {1, 9}, {2, 7}, {3, 5}, {4, 6}, {0, 2}, {1, 4}, {5, 8}, {7, 9}, {0, 3}, {2, 4}, {5, 7},
+        {6, 9}, {0, 1}, {3, 6}, {8, 9}, {1, 5}, {2, 3}, {4, 8}, {6, 7}, {1, 2}, {3, 5}, {4, 6}, {7, 8},
+        {2, 3}, {4, 5}, {6, 7}, {3, 4}, {5, 6}
+    }};
+};
+
+template <>
+struct NetworkSchedule<12> {
+    static constexpr std::array<Comparator, 39> comparators = {{
+        {0, 8}, {1, 7}, {2, 6}, {3, 11}, {4, 10}, {5, 9}, {0, 1}, {2, 5}, {3, 4}, {6, 9}, {7, 8},
+        {10, 11}, {0, 2}, {1, 6}, {5, 10}, {9, 11}, {0, 3}, {1, 2}, {4, 6}, {5, 7}, {8, 11}, {9, 10},
+        {1, 4}, {3, 5}, {6, 8}, {7, 10}, {1, 3}, {2, 5}, {6, 9}, {8, 10}, {2, 3}, {4, 5}, {6, 7},
+        {8, 9}, {4, 6}, {5, 7}, {3, 4}, {5, 6}, {7, 8}
+    }};
+};
+
+template <>
+struct NetworkSchedule<16> {
+    static constexpr std::array<Comparator, 60> comparators = {{
+        {0, 13}, {1, 12}, {2, 15}, {3, 14}, {4, 8}, {5, 6}, {7, 11}, {9, 10}, {0, 5}, {1, 7}, {2, 9},
+        {3, 4}, {6, 13}, {8, 14}, {10, 15}, {11, 12}, {0, 1}, {2, 3}, {4, 5}, {6, 8}, {7, 9}, {10, 11},
+        {12, 13}, {14, 15}, {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9}, {12, 14}, {13, 15},
+        {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {13, 14}, {1, 4}, {2, 6}, {5, 8}, {7, 10},
+        {9, 13}, {11, 14}, {2, 4}, {3, 6}, {9, 12}, {11, 13}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {3, 4},
+        {5, 6}, {7, 8}, {9, 10}, {11, 12}, {6, 7}, {8, 9}
+    }};
+};
+
+// Branchless compare-exchange; compilers lower the selects to cmov/min/max.
+inline void compareExchange(int* data, std::size_t a, std::size_t b) {
+    const int x = data[a];
+    const int y = data[b];
+    const bool ordered = x <= y;
+    data[a] = ordered ? x : y;
+    data[b] = ordered ? y : x;
+}
+
+// Fully unrolled network for N elements.
+template <std::size_t N>
+struct SortingNetwork {
+    using Schedule = NetworkSchedule<N>;
+
+    // Number of compare-exchanges in the network.
+    static constexpr std::size_t comparatorCount() {
+        return Schedule::comparators.size();
+    }
+
+    // Applies every comparator in order; the indices are compile-time constants.
+    static void sort(int* data) {
+        apply(data, std::make_index_sequence<Schedule::comparators.size()>{});
+    }
+
+private:
+    template <std::size_t... I>
+    static void apply(int* data, std::index_sequence<I...>) {
+        (compareExchange(data, Schedule::comparators[I].a, Schedule::comparators[I].b), ...);
+        (void)data;
+    }
+};
+
+// Runtime dispatch from n to the unrolled network of that size.
+class SortingNetworks {
+public:
+    // Largest size with a generated network.
+    static constexpr std::size_t kMaxSize = 64;
+
+private:
+    using SortFn = void (*)(int*);
+
+    template <std::size_t... Sizes>
+    static constexpr std::array<SortFn, sizeof...(Sizes)> makeTable(std::index_sequence<Sizes...>) {
+        return {{&SortingNetwork<Sizes>::sort...}};
+    }
+
+    template <std::size_t... Sizes>
+    static constexpr std::array<std::size_t, sizeof...(Sizes)> makeCounts(std::index_sequence<Sizes...>) {
+        return {{SortingNetwork<Sizes>::comparatorCount()...}};
+    }
+
+    static const std::array<SortFn, kMaxSize + 1>& table() {
+        static constexpr std::array<SortFn, kMaxSize + 1> dispatch = makeTable(std::make_index_sequence<kMaxSize + 1>{});
+        return dispatch;
+    }
+
+    static const std::array<std::size_t, kMaxSize + 1>& counts() {
+        static constexpr std::array<std::size_t, kMaxSize + 1> sizes = makeCounts(std::make_index_sequence<kMaxSize + 1>{});
+        return sizes;
+    }
+
+public:
+    // Sorts data[0, n) with the network for n; returns false when n is larger than kMaxSize.
+    static bool sort(int* data, std::size_t n) {
+        if (n > kMaxSize) {
+            return false;
+        }
+        table()[n](data);
+        return true;
+    }
+
+    // Comparator count of the network used for n (0 when n is larger than kMaxSize).
+    static std::size_t comparatorCount(std::size_t n) {
+        return n > kMaxSize ? 0 : counts()[n];
+    }
+};
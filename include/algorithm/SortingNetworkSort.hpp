@@ -0,0 +1,39 @@
+// include/algorithm/SortingNetworkSort.hpp
+#pragma once
+#include "../model/Algorithm.hpp"
+#include "SortingNetwork.hpp"
+#include <cstddef>
+
+class SortingNetworkSort : public Algorithm {
+private:
+    // Batch parameters
+    std::size_t width = 8;
+    bool useSimd = true;
+    // Whether the CPU can run the AVX2 lane kernels, detected at construction.
+    bool simdAvailable;
+
+    // Overrides from Algorithm
+    // Prints the array contents for visualization.
+    void display(const std::vector<int>& elements) override;
+
+public:
+    // Detects whether the vectorized batch kernels can run.
+    SortingNetworkSort();
+
+    // Overrides from Algorithm
+    // Sorts every block of the list independently without printing.
+    void execute(DataStructure* ds) override;
+    // Sorts the blocks and prints the list before and after.
+    void executeAndDisplay(DataStructure* ds) override;
+    // Returns the algorithm name with block width, comparator count and kernel.
+    std::string getName() const override;
+
+    // Sorts each consecutive block of width elements on its own; a shorter tail forms the last block.
+    void sortBatches(std::vector<int>& elements) const;
+
+    // Setters for parameters
+    // Sets the block width, clamped to [2, SortingNetworks::kMaxSize].
+    void setWidth(std::size_t size);
+    // Chooses between eight-blocks-per-register AVX2 kernels and one block at a time.
+    void setUseSimd(bool enabled);
+};
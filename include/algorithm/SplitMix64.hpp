@@ -0,0 +1,12 @@
+// include/algorithm/SplitMix64.hpp
+#pragma once
+#include <cstdint>
+
+// SplitMix64 step shared by the selection algorithms: cheap, reproducible from a seed, and good enough to
+// pick sample positions and fill generated benchmark chunks. Advances state and returns the next value.
+inline std::uint64_t splitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
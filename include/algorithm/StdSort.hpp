@@ -0,0 +1,35 @@
+// include/algorithm/StdSort.hpp
+#pragma once
+#include "../model/Algorithm.hpp"
+
+class StdSort : public Algorithm {
+public:
+    // Standard library entry points wrapped by this baseline
+    enum class Variant {
+        SORT,
+        STABLE_SORT,
+        PARALLEL_SORT
+    };
+
+private:
+    Variant variant = Variant::SORT;
+
+    // Overrides from Algorithm
+    // Prints the array contents for visualization.
+    void display(const std::vector<int>& elements) override;
+
+public:
+    // Overrides from Algorithm
+    // Sorts a copy of the elements with the selected standard algorithm.
+    void execute(DataStructure* ds) override;
+    // Sorts and prints the array before and after.
+    void executeAndDisplay(DataStructure* ds) override;
+    // Returns the name of the wrapped standard call.
+    std::string getName() const override;
+
+    // Chooses which standard library call is measured.
+    void setVariant(Variant choice);
+
+    // Reports whether std::execution::par_unseq was compiled in (define RAYSTRUCT_PARALLEL_STL).
+    static bool parallelAvailable();
+};
@@ -0,0 +1,80 @@
+// include/algorithm/StreamingSelection.hpp
+#pragma once
+#include "../model/SelectionAlgorithm.hpp"
+#include "../core/Enums.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class StreamingSelection : public SelectionAlgorithm {
+public:
+    // Where the stream comes from
+    enum class Source {
+        STRUCTURE,
+        FILE,
+        GENERATOR
+    };
+
+private:
+    // Stream parameters
+    Source source = Source::STRUCTURE;
+    std::string filePath;
+    std::size_t generatorCount = 0;
+    std::uint64_t generatorSeed = 1;
+    std::size_t chunkElements = std::size_t(1) << 20;
+    unsigned threadCount = 1;
+    SimdLevel level;
+
+    // Statistics of the last run
+    std::size_t elementsStreamed = 0;
+    double lastSeconds = 0.0;
+    // Threads that consumed chunks: at most one per chunk, so it can be below threadCount
+    unsigned threadsUsed = 0;
+    bool lastRunValid = false;
+
+    // Streams the configured source through per-thread top-k buffers and merges them.
+    void stream(DataStructure* ds);
+
+protected:
+    // Overrides from SelectionAlgorithm
+    // Streams an in-memory vector in chunks; used when the structure itself is the source.
+    int select(std::vector<int>& elements) override;
+    // Prints the result together with throughput.
+    void display(const std::vector<int>& elements) override;
+
+public:
+    // Picks the widest instruction set the running CPU supports.
+    StreamingSelection();
+
+    // Overrides from Algorithm
+    // Streams the source without printing.
+    void execute(DataStructure* ds) override;
+    // Streams the source and prints the result and throughput.
+    void executeAndDisplay(DataStructure* ds) override;
+    // Returns the algorithm name with source, chunk size and thread count.
+    std::string getName() const override;
+    // Hands chunks to tasks on the context's thread pool.
+    bool isParallel() const override;
+    // Current task count.
+    unsigned getThreadCount() const override;
+
+    // Setters for parameters
+    // Streams the elements of the benchmarked structure (the default).
+    void useStructure();
+    // Streams a raw file of native-endian 32-bit integers.
+    void setFile(const std::string& path);
+    // Streams count pseudo-random integers; chunk i is derived from seed and i, so results do not depend on threads.
+    void setGenerator(std::size_t count, std::uint64_t seed);
+    // Sets how many elements are read per chunk (at least one).
+    void setChunkElements(std::size_t elements);
+    // Sets how many threads consume chunks (at least one).
+    void setThreadCount(unsigned threads) override;
+
+    // Statistics of the last run
+    // Elements consumed by the last run.
+    std::size_t getElementsStreamed() const;
+    // Elements per second of the last run.
+    double getThroughput() const;
+    // Threads the last run actually used.
+    unsigned getThreadsUsed() const;
+};
@@ -0,0 +1,40 @@
+// include/algorithm/TopKBuffer.hpp
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "../core/Enums.hpp"
+
+// Keeps the k best keys seen so far in a heap whose front is the worst of them.
+// Once full, that key is the threshold for a vectorized filter, so most keys never touch the heap.
+class TopKBuffer {
+private:
+    std::size_t capacity;
+    bool keepLargest;
+    SimdLevel level;
+    std::vector<int> heap;
+    // Filter output for one block.
+    std::vector<int> candidates;
+
+    // True when a belongs ahead of b in the kept set.
+    bool better(int a, int b) const;
+    // Replaces the worst kept key with value.
+    void replaceWorst(int value);
+
+public:
+    // Keeps the k largest (keepLargest) or k smallest keys using the given instruction set for the filter.
+    TopKBuffer(std::size_t k, bool keepLargest, SimdLevel level);
+
+    // Feeds n more keys through the filter and heap.
+    void offer(const int* data, std::size_t n);
+    // Folds another buffer's keys into this one.
+    void merge(const TopKBuffer& other);
+
+    // Number of keys kept so far (at most k).
+    std::size_t size() const;
+    // True once k keys have been seen.
+    bool full() const;
+    // Worst kept key, i.e. the k-th best so far; only valid when size() > 0.
+    int threshold() const;
+    // The kept keys, best first.
+    std::vector<int> sortedBest() const;
+};
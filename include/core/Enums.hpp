@@ -18,6 +18,32 @@ enum class AlgorithmEnum {
     HEAP_SELECTION,
     A_STAR,
     PRIMS,
+    SIMD_SORT,
+    RADIX_SORT,
+    STD_SORT,
+    PDQ_SORT,
+    SORTING_NETWORK,
+    QUICK_SELECT,
+    SIMD_SELECTION,
+    STREAMING_SELECTION,
+    PARALLEL_SELECTION,
+    EXTERNAL_MERGE_SORT,
+    KWAY_MERGE,
     CUSTOM,
     UNKNOWN
-};
\ No newline at end of file
+};
+
+// Enumeration for the vector instruction sets used by the SIMD kernels
+enum class SimdLevel {
+    SCALAR,
+    SSE4,
+    AVX2
+};
+// Enumeration for the optimisation profiles custom plugins can be compiled with
+enum class BuildProfile {
+    DEBUG,
+    O2,
+    O3_NATIVE,
+    LTO,
+    CUSTOM
+};
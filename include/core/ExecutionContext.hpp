@@ -0,0 +1,9 @@
+// include/core/ExecutionContext.hpp
+#pragma once
+#include "ThreadPool.hpp"
+
+// Runtime services the benchmark hands to every algorithm before it runs.
+struct ExecutionContext {
+    // Shared task runtime; algorithms queue work here instead of starting their own threads.
+    ThreadPool* pool = nullptr;
+};
@@ -0,0 +1,81 @@
+// include/core/ThreadPool.hpp
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+// Task runtime shared by every algorithm. Only the virtual functions cross the boundary, and the
+// fork/join helpers below are templates built on them, so plugins compiled against this header can
+// use the pool without linking to anything in the host executable.
+class ThreadPool {
+public:
+    // Set of tasks that are waited on together; the scope of one fork/join.
+    class TaskGroup {
+    public:
+        TaskGroup() = default;
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        // Tasks submitted to the group that have not finished yet.
+        std::atomic<std::size_t> pending{0};
+        // First exception thrown by a task, rethrown by wait().
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    virtual ~ThreadPool() = default;
+
+    // Number of threads that run tasks, counting the thread blocked in wait().
+    virtual unsigned threadCount() const = 0;
+    // Queues a task in the group; it may run on any thread of the pool.
+    virtual void submit(TaskGroup& group, std::function<void()> task) = 0;
+    // Runs queued tasks on the calling thread until every task of the group has finished.
+    virtual void wait(TaskGroup& group) = 0;
+
+    // Runs left on this thread and right on the pool, returning when both are done.
+    template <typename Left, typename Right>
+    void forkJoin(Left&& left, Right&& right) {
+        TaskGroup group;
+        submit(group, std::forward<Right>(right));
+        try {
+            left();
+        } catch (...) {
+            wait(group);
+            throw;
+        }
+        wait(group);
+    }
+
+    // Calls fn(chunkBegin, chunkEnd) over [begin, end) in chunks of at most grain indices.
+    template <typename Fn>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Fn&& fn) {
+        if (grain == 0) {
+            grain = 1;
+        }
+        TaskGroup group;
+        for (std::size_t chunk = begin; chunk < end; chunk += grain) {
+            const std::size_t chunkEnd = end - chunk > grain ? chunk + grain : end;
+            submit(group, [&fn, chunk, chunkEnd]() { fn(chunk, chunkEnd); });
+        }
+        wait(group);
+    }
+
+    // Calls fn(t) for t in [0, tasks): task 0 runs on the calling thread, the rest on the pool.
+    template <typename Fn>
+    void runTasks(unsigned tasks, Fn&& fn) {
+        TaskGroup group;
+        for (unsigned t = 1; t < tasks; ++t) {
+            submit(group, [&fn, t]() { fn(t); });
+        }
+        try {
+            fn(0u);
+        } catch (...) {
+            wait(group);
+            throw;
+        }
+        wait(group);
+    }
+};
@@ -0,0 +1,84 @@
+// include/core/WorkStealingThreadPool.hpp
+#pragma once
+#include "ExecutionContext.hpp"
+#include "ThreadPool.hpp"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Thread pool with one deque per worker. A worker pushes and pops its own tasks at the back (LIFO, so
+// nested forks stay cache-hot) and steals from the front of the others when it runs dry. Threads outside
+// the pool submit to a shared injection queue and help run tasks while they wait.
+class WorkStealingThreadPool : public ThreadPool {
+private:
+    // A queued task and the group it reports to.
+    struct Task {
+        std::function<void()> run;
+        TaskGroup* group = nullptr;
+    };
+
+    // Deque of one worker (the last one is the injection queue).
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // Pool configuration
+    unsigned threads = 1;
+    bool pinned = false;
+    // CPUs the workers are pinned to, in order; empty means CPU 1, 2, ... of the machine.
+    std::vector<unsigned> cpuList;
+
+    // Runtime state
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<std::size_t> queued{0};
+    std::atomic<bool> stopping{false};
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+    // Signalled when a group finishes or a task is queued, for threads blocked in wait()
+    std::condition_variable doneCondition;
+
+    // Starts threads - 1 workers (the waiting thread is the last one), pinning them if requested.
+    void start();
+    // Stops and joins the workers.
+    void stop();
+    // Runs tasks until the pool stops, sleeping while every queue is empty.
+    void workerLoop(std::size_t index);
+    // Takes a task for the queue at index: its own back first, then the front of every other queue.
+    bool findTask(std::size_t index, Task& task);
+    // Runs a task, records its exception and signals its group.
+    void runTask(Task& task);
+    // Queue index of the calling thread (the injection queue for threads outside the pool).
+    std::size_t callerQueue() const;
+
+public:
+    // Creates a pool running tasks on the given number of threads (at least one).
+    explicit WorkStealingThreadPool(unsigned threadCount, bool pinThreads = false);
+    // Stops the workers; pending tasks must have been waited on.
+    ~WorkStealingThreadPool() override;
+
+    // Overrides from ThreadPool
+    // Number of threads that run tasks, counting the waiting thread.
+    unsigned threadCount() const override;
+    // Pushes the task on the caller's deque (or the injection queue) and wakes a worker.
+    void submit(TaskGroup& group, std::function<void()> task) override;
+    // Runs or steals tasks until the group is done, then rethrows the first task exception.
+    void wait(TaskGroup& group) override;
+
+    // Restarts the workers with a new thread count and affinity; only valid while no tasks are pending.
+    void configure(unsigned threadCount, bool pinThreads);
+    // Restarts the workers pinned to the given CPUs: the waiting thread is expected on cpus[0] and worker w
+    // goes to cpus[1 + w % (size - 1)], so none shares the waiting thread's CPU unless the list has only
+    // that one. An empty list unpins them.
+    void pinTo(const std::vector<unsigned>& cpus);
+    // True when every worker is pinned to its own CPU.
+    bool isPinned() const;
+
+    // Process-wide pool sized by RAYSTRUCT_THREADS (default: hardware threads); RAYSTRUCT_PIN_THREADS=1 pins it.
+    static WorkStealingThreadPool& shared();
+    // Pool of the context, or the shared pool when the algorithm runs outside a benchmark.
+    static ThreadPool& poolFor(const ExecutionContext* context);
+};
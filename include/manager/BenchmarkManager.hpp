@@ -6,14 +6,85 @@
 #include <cstddef>
 #include <cstdio>
 #include <fstream>
+#include <vector>
 #include "../structure/DataStructureFactory.hpp"
 #include "../algorithm/AlgorithmFactory.hpp"
+#include "../core/ExecutionContext.hpp"
+#include "BenchmarkOptions.hpp"
+
+// One measurement of a scaling sweep.
+struct ScalingPoint {
+    unsigned threads = 1;
+    std::size_t elements = 0;
+    double milliseconds = 0.0;
+    // Strong scaling: T1 / Tp. Weak scaling: T1 / Tp with p times the work, so 1.0 is ideal.
+    double speedup = 0.0;
+    double efficiency = 0.0;
+    // Karp-Flatt estimate of the serial fraction (strong scaling only, 0 at one thread).
+    double serialFraction = 0.0;
+};
+
+// Timing and OS counters of repeated execute() calls on one input.
+struct ExecutionSample {
+    int runs = 0;
+    double bestMs = 0.0;
+    double meanMs = 0.0;
+    // Process-wide getrusage deltas over all runs (pool workers included); zero where unsupported
+    double userMs = 0.0;
+    double systemMs = 0.0;
+    long minorFaults = 0;
+    long majorFaults = 0;
+    long voluntarySwitches = 0;
+    long involuntarySwitches = 0;
+    // False when a run threw, or a subprocess run crashed, hit a limit or could not be started; failure says why
+    bool completed = true;
+    std::string failure;
+    // Set when the watchdog stopped the run at options.timeBudgetMs; failure then reads "timed out at > X ms"
+    bool timedOut = false;
+    // Subprocess runs only: the child's RSS before the first run and its peak RSS, in kB
+    long baselineRssKb = 0;
+    long peakRssKb = 0;
+};
+
+// One cell of an input-size sweep.
+struct SizeSweepPoint {
+    std::size_t elements = 0;
+    // Not run because the algorithm already timed out or failed at a smaller size
+    bool skipped = false;
+    ExecutionSample sample;
+};
+
+// One algorithm across all sizes of an input-size sweep.
+struct SizeSweepRow {
+    std::string algorithm;
+    std::vector<SizeSweepPoint> points;
+    // Smallest size that did not finish, 0 when every size did
+    std::size_t cutoffElements = 0;
+};
+
+// Strong (fixed input) and weak (input grows with threads) scaling curves of one algorithm.
+struct ScalingReport {
+    std::vector<ScalingPoint> strong;
+    std::vector<ScalingPoint> weak;
+};
 
 class BenchmarkManager {
 private:
     // Resource usage tracking
     double lastRSSKb = 0, lastSharedKb = 0, lastPrivateKb = 0;
 
+    // Runtime handed to every benchmarked algorithm
+    ExecutionContext context;
+
+    // Pinning, scheduling and memory settings applied around every timed run
+    BenchmarkOptions options;
+
+    // How the benchmarked code was compiled; empty means the host build
+    std::string buildDescription;
+
+    // sampleExecution without the subprocess dispatch, on runContext's pool; this is what the child runs.
+    ExecutionSample sampleInProcess(DataStructure* ds, Algorithm* algo, int repetitions, ExecutionContext& runContext);
+
     // Helper functions for resource tracking
     // Captures the ending RSS/shared/private stats.
     void getCurrentRSSBytes();
@@ -22,8 +93,43 @@ private:
     
 public:
     // Constructor
-    BenchmarkManager() = default;
+    // Starts the shared thread pool so worker creation never lands in a timed region, and reads the
+    // isolation settings from the RAYSTRUCT_BENCH_* environment variables.
+    BenchmarkManager();
+
+    // Replaces the thread pool handed to algorithms (for example a differently sized or pinned pool).
+    void setThreadPool(ThreadPool* pool);
 
-    // Executes the algorithm while recording timing and memory metrics.
+    // Replaces the isolation settings used by runBenchmark and runScalingSweep.
+    void setOptions(const BenchmarkOptions& newOptions);
+    // Current isolation settings.
+    const BenchmarkOptions& getOptions() const;
+
+    // Records the plugin build profile printed with the next results (empty for built-in code).
+    void setBuildDescription(const std::string& description);
+
+    // Executes the algorithm while recording timing and memory metrics; a run that throws is reported as
+    // aborted.
     void runBenchmark(DataStructure* ds, Algorithm* algo);
+
+    // Quietly times execute() under the current isolation options and returns the best of repetitions runs
+    // in milliseconds, after an untimed prepare(). Used by comparisons that print their own table.
+    double timeExecution(DataStructure* ds, Algorithm* algo, int repetitions = 5);
+    // Like timeExecution, but also reports the mean and the CPU time, page fault and context switch counts.
+    // With options.usesSubprocess() the runs happen in a forked child; a crash, limit or spent time budget comes back as
+    // completed == false instead of ending the session.
+    ExecutionSample sampleExecution(DataStructure* ds, Algorithm* algo, int repetitions = 5);
+
+    // Runs a parallel algorithm at 1, 2, 4, ... maxThreads threads, each on a pool of that size, on the
+    // same input (strong scaling) and on the input repeated once per thread (weak scaling).
+    // Each point is the best of repetitions runs; prints both tables and returns them.
+    ScalingReport runScalingSweep(DataStructure* ds, Algorithm* algo, unsigned maxThreads, int repetitions = 3);
+
+    // Times each algorithm on random inputs (uniform in [0, 100000], fixed seed) of every size, smallest
+    // first. Once an algorithm times out or fails, its larger sizes are skipped, so a quadratic algorithm
+    // stops costing a full budget per size while the n log n ones carry on. Prints the table.
+    std::vector<SizeSweepRow> runSizeSweep(const std::vector<Algorithm*>& algorithms, const std::vector<std::size_t>& sizes,
+                                           int repetitions = 3);
+    // 1-2-5 steps from 1000 up to maxElements, which is always the last size.
+    static std::vector<std::size_t> sizeSweepSteps(std::size_t maxElements);
 };
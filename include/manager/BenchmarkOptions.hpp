@@ -0,0 +1,49 @@
+// include/manager/BenchmarkOptions.hpp
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// How the benchmark isolates a timed run from the rest of the machine. Everything is off by default;
+// each setting is best effort and a run still happens when the OS refuses it.
+struct BenchmarkOptions {
+    // CPUs for the run: the timing thread is pinned to the first one and, for parallel algorithms, the
+    // pool workers to the rest. Empty leaves placement to the scheduler.
+    std::vector<unsigned> cpus;
+    // Run the timing thread under SCHED_FIFO (needs root or CAP_SYS_NICE).
+    bool realtime = false;
+    // SCHED_FIFO priority; 0 picks the lowest real-time priority.
+    int realtimePriority = 0;
+    // Lock current and future pages with mlockall so nothing is paged out or faulted lazily.
+    bool lockMemory = false;
+    // Touch a copy of the input (and as much scratch space again) before timing, and keep the allocator
+    // from handing those pages back, so the run does not pay for first-touch page faults.
+    bool prefault = false;
+
+    // Run each timed benchmark in a forked child (Linux only): a crash or limit only ends the child, and
+    // memory figures start from the child's own baseline instead of everything run so far.
+    bool subprocess = false;
+    // Child limits, 0 for none. CPU time is RLIMIT_CPU and address space RLIMIT_AS; Linux ignores
+    // RLIMIT_RSS, so the RSS limit is enforced by the parent killing the child when it is exceeded.
+    unsigned cpuLimitSeconds = 0;
+    std::size_t addressSpaceLimitMb = 0;
+    std::size_t rssLimitMb = 0;
+    // Wall-clock budget of the timed repetitions of one benchmark in milliseconds, 0 for none. It starts when
+    // the child reports that timing begins (after fork, pool start-up and prepare()); a watchdog in the
+    // parent kills the child once it is spent and the run is recorded as timed out.
+    double timeBudgetMs = 0.0;
+
+    // True when any of the settings is enabled.
+    bool any() const;
+    // True when runs go through a forked child: requested directly, or implied by a limit or budget.
+    bool usesSubprocess() const;
+    // One-line summary such as "cpus 2,3; SCHED_FIFO; mlockall; prefault; subprocess (cpu 60 s, rss 512 MB)".
+    std::string describe() const;
+
+    // Parses a CPU list like "2" or "0,2-3"; returns false (leaving cpus untouched) on malformed input.
+    static bool parseCpuList(const std::string& text, std::vector<unsigned>& cpus);
+    // Reads RAYSTRUCT_BENCH_CPUS, RAYSTRUCT_BENCH_FIFO (0 or a priority), RAYSTRUCT_BENCH_MLOCK=1,
+    // RAYSTRUCT_BENCH_PREFAULT=1, RAYSTRUCT_BENCH_FORK=1 and the limits RAYSTRUCT_BENCH_CPU_LIMIT (seconds),
+    // RAYSTRUCT_BENCH_AS_LIMIT_MB, RAYSTRUCT_BENCH_RSS_LIMIT_MB and RAYSTRUCT_BENCH_BUDGET_MS (which imply the fork).
+    static BenchmarkOptions fromEnvironment();
+};
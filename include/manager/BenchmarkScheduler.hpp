@@ -0,0 +1,85 @@
+// include/manager/BenchmarkScheduler.hpp
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "BenchmarkManager.hpp"
+
+// CPUs this process may use, grouped by physical core and by shared L3 cache.
+struct CoreTopology {
+    // Hardware threads (SMT siblings) of each core, lowest CPU first
+    std::vector<std::vector<unsigned>> cores;
+    // Indices into cores for each L3 domain
+    std::vector<std::vector<std::size_t>> l3Domains;
+
+    // Reads topology/thread_siblings_list and the level-3 cache entry of each CPU under sysfsRoot. A CPU
+    // without sibling information is its own core; without an L3 entry, all cores share one domain.
+    static CoreTopology fromSysfs(const std::string& sysfsRoot, const std::vector<unsigned>& cpus);
+    // This machine, limited to the CPUs in the process's affinity mask.
+    static CoreTopology detect();
+};
+
+// How the machine is split into slots that each run one benchmark at a time.
+enum class SlotGranularity {
+    // One slot per physical core, on its first hardware thread; SMT siblings stay idle
+    CORE,
+    // One slot per L3 domain holding all of its cores, for parallel algorithms
+    L3
+};
+
+// One benchmark of a batch. The structure and algorithm belong to the caller; every run happens in a
+// forked child, so several scenarios may share them.
+struct BenchmarkScenario {
+    std::string name;
+    DataStructure* ds = nullptr;
+    Algorithm* algo = nullptr;
+    int repetitions = 5;
+    // Bandwidth-bound work that neighbours would skew: run alone after the concurrent part
+    bool serial = false;
+};
+
+// Outcome of one scenario.
+struct ScheduledRun {
+    std::string scenario;
+    std::vector<unsigned> cpus;
+    bool serial = false;
+    // Wall time of the whole run seen from the scheduler, fork and prepare() included
+    double wallMs = 0.0;
+    ExecutionSample sample;
+};
+
+// Runs a batch of independent benchmarks concurrently, one per slot of disjoint CPUs, each in a forked
+// child pinned to its slot. Consecutive slots alternate between L3 domains, so a batch smaller than the
+// machine gets as many caches to itself as possible.
+class BenchmarkScheduler {
+private:
+    CoreTopology topology;
+    SlotGranularity granularity = SlotGranularity::CORE;
+    BenchmarkOptions options;
+    bool forceSerial = false;
+    // 0 uses every slot
+    std::size_t maxConcurrent = 0;
+
+public:
+    // Schedules on the given machine (detected by default).
+    explicit BenchmarkScheduler(const CoreTopology& machine = CoreTopology::detect());
+
+    // Core or L3-domain slots.
+    void setGranularity(SlotGranularity slotGranularity);
+    // Limits, budget and other settings for every child; cpus is replaced by each slot's CPUs.
+    void setOptions(const BenchmarkOptions& baseOptions);
+    // Runs the whole batch one scenario at a time on the first slot, e.g. for memory-bandwidth studies.
+    void setForceSerial(bool enabled);
+    // Caps the number of slots in use (0 for all of them).
+    void setMaxConcurrent(std::size_t slotCount);
+
+    // The disjoint CPU sets scenarios are pinned to, in the order they are handed out.
+    std::vector<std::vector<unsigned>> slots() const;
+
+    // Runs every scenario and returns the results in scenario order. Concurrent scenarios are taken from
+    // a shared queue by one thread per slot; serial ones follow, one at a time. Prints the table.
+    std::vector<ScheduledRun> run(const std::vector<BenchmarkScenario>& scenarios) const;
+
+    // Compact CPU list such as "0-3,8".
+    static std::string formatCpus(const std::vector<unsigned>& cpus);
+};
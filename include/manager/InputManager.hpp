@@ -4,9 +4,15 @@
 #include <algorithm>
 #include "../structure/DataStructureFactory.hpp"
 #include "../algorithm/AlgorithmFactory.hpp"
+#include "PluginCompiler.hpp"
 
 class InputManager {
 private:
+    // Compiler settings shared by custom structure and algorithm builds
+    PluginCompiler pluginCompiler;
+    // Content-hashed store of compiled plugins, outside the source tree
+    PluginCache pluginCache;
+
     // Helper functions
     // Removes surrounding whitespace so menu parsing is consistent.
     std::string trim(const std::string& str);
@@ -17,17 +23,22 @@ private:
     // Ensures the requested algorithm can run on the chosen structure.
     bool isAlgorithmCompatible(AlgorithmEnum algorithm, DataStructureEnum structureType);
     // Handles validating and compiling a custom structure uploaded by the user.
-    bool promptCustomStructurePath(std::string& outPath, std::string& compilerOutput, std::string& libraryPath);
+    bool promptCustomStructurePath(std::string& outPath, std::string& compilerOutput, std::string& libraryPath,
+                                   std::string& buildDescription);
     // Checks whether the custom structure file satisfies the base contract.
     bool validateCustomStructureFile(const std::string& filePath, std::string& errorMessage);
     // Compiles the validated custom structure into a shared library.
-    bool compileCustomStructure(const std::string& filePath, std::string& compilerOutput, std::string& libraryPath);
+    bool compileCustomStructure(const std::string& filePath, PluginBuild& build);
     // Handles validating and compiling a custom algorithm uploaded by the user.
-    bool promptCustomAlgorithmPath(std::string& outPath, std::string& compilerOutput, std::string& libraryPath);
-    // Verifies that a custom algorithm derives from Algorithm and implements overrides.
+    bool promptCustomAlgorithmPath(std::string& outPath, std::string& compilerOutput, std::string& libraryPath,
+                                   std::string& buildDescription);
+    // Verifies that a custom algorithm derives from Algorithm and implements overrides, or exports the
+    // raw-buffer entry point from PluginAbi.hpp.
     bool validateCustomAlgorithmFile(const std::string& filePath, std::string& errorMessage);
     // Compiles the validated custom algorithm into a shared library.
-    bool compileCustomAlgorithm(const std::string& filePath, std::string& compilerOutput, std::string& libraryPath);
+    bool compileCustomAlgorithm(const std::string& filePath, PluginBuild& build);
+    // Asks which optimisation profile the next plugin is built with; returns false when the user exits.
+    bool promptBuildProfile();
 
 public:
     // Struct that saves the result of structure selection
@@ -37,6 +48,7 @@ public:
         std::string customStructurePath; // for custom structure
         std::string customStructureCompileOutput; // compiler output
         std::string customStructureLibraryPath; // path to compiled library
+        std::string customStructureBuild; // build profile and flags
     };
 
     // Struct that saves the result of algorithm selection
@@ -46,6 +58,7 @@ public:
         std::string customAlgorithmPath; // for custom algorithms
         std::string customAlgorithmCompileOutput; // compiler output
         std::string customAlgorithmLibraryPath; // path to compiled library
+        std::string customAlgorithmBuild; // build profile and flags
     };
 
     // Public methods for user selection
@@ -60,6 +73,9 @@ public:
     // Instantiates either built-in or custom algorithms.
     Algorithm* createAlgorithm(const AlgorithmSelection& selection) const;
 
+    // Compiler settings chosen in the last plugin wizard, for rebuilding the plugin (e.g. with PGO).
+    const PluginCompiler& getPluginCompiler() const;
+
     // Method to populate data structure with initial data
     // Launches the input loop for adding elements or graph edges.
     bool populateDS(DataStructure* ds, DataStructureEnum structureType);
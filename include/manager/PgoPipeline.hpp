@@ -0,0 +1,48 @@
+// include/manager/PgoPipeline.hpp
+#pragma once
+#include <cstddef>
+#include <string>
+#include "BenchmarkManager.hpp"
+#include "PluginCompiler.hpp"
+
+// Result of one profile-guided optimisation comparison.
+struct PgoComparison {
+    bool succeeded = false;
+    // Why the pipeline stopped, when it did
+    std::string message;
+    PluginBuild baseline;
+    PluginBuild instrumented;
+    PluginBuild optimised;
+    // .gcda files the training run produced
+    std::size_t profileFiles = 0;
+    double trainingMs = 0.0;
+    double baselineMs = 0.0;
+    double optimisedMs = 0.0;
+
+    // Baseline time over PGO time (above 1 means PGO helped).
+    double speedup() const;
+};
+
+// Builds a custom algorithm three times with the same profile: plain, instrumented with -fprofile-generate
+// and optimised with -fprofile-use after a training run through AlgorithmFactory. The plain and PGO
+// builds are then timed one after the other on the benchmark input, each loaded on its own.
+class PgoPipeline {
+private:
+    PluginCompiler compiler;
+    std::string workDirectory;
+    int repetitions = 5;
+
+public:
+    // Copies the compiler settings (profile, custom flags); profile data and the PGO builds go to
+    // workDirectory, or to a fresh temporary directory when it is empty. The directory is removed afterwards.
+    explicit PgoPipeline(const PluginCompiler& baseCompiler, const std::string& workDirectory = "");
+
+    // Timed runs per build; the best one counts.
+    void setRepetitions(int count);
+
+    // Trains on the training input, times both builds on the benchmark input and prints the comparison.
+    // Training should be a separate input of the same kind; training on the benchmark input itself
+    // flatters the PGO build. The caller unloads any build of the same plugin it holds beforehand.
+    PgoComparison run(const std::string& sourcePath, DataStructure* training, DataStructure* benchmark,
+                      BenchmarkManager& benchmarkManager);
+};
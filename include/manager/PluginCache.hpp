@@ -0,0 +1,39 @@
+// include/manager/PluginCache.hpp
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Directory of compiled plugins keyed by a hash of everything that affects the build: the source, the
+// project headers it includes, the compiler version and the flags. A key that is already present means
+// the shared object can be loaded as is, without running the compiler.
+class PluginCache {
+private:
+    std::string directory;
+
+public:
+    // Uses the given directory, or defaultDirectory() when it is empty.
+    explicit PluginCache(const std::string& cacheDirectory = "");
+
+    // Where the entries live.
+    const std::string& getDirectory() const;
+    // Creates the directory if needed; false when it cannot be written to.
+    bool isUsable() const;
+    // Library path of the entry for a source stem and key: <directory>/<stem>_<key as 16 hex digits>_custom.so.
+    std::string entryPath(const std::string& stem, std::uint64_t key) const;
+    // Deletes every entry, subdirectories included; returns how many files and directories were removed.
+    std::size_t clear() const;
+
+    // RAYSTRUCT_CACHE_DIR, else $XDG_CACHE_HOME/raystruct, else ~/.cache/raystruct.
+    static std::string defaultDirectory();
+    // 64-bit FNV-1a, chainable through the seed.
+    static std::uint64_t fnv1a(const std::string& data, std::uint64_t seed = 14695981039346656037ull);
+    // Hashes the source and, recursively, every #include "..." it pulls in from its own directory or the
+    // include directories. Angle-bracket headers belong to the toolchain and are covered by the compiler
+    // version instead. A missing source hashes to 0.
+    static std::uint64_t hashSource(const std::string& sourcePath, const std::vector<std::string>& includeDirectories);
+    // Output of "<compiler> --version", read once per compiler and process.
+    static std::string compilerIdentity(const std::string& compiler);
+    // Model name and feature flags of this machine's CPU, for keys of -march=native builds.
+    static std::string cpuSignature();
+};
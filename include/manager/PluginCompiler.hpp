@@ -0,0 +1,85 @@
+// include/manager/PluginCompiler.hpp
+#pragma once
+#include <cstdint>
+#include <string>
+#include "../core/Enums.hpp"
+#include "PluginCache.hpp"
+
+// Outcome of compiling one custom plugin.
+struct PluginBuild {
+    bool succeeded = false;
+    std::string compiler;
+    BuildProfile profile = BuildProfile::O2;
+    // Optimisation flags of the profile, e.g. "-O3 -march=native"
+    std::string flags;
+    // Full compiler command line, minus the output redirection
+    std::string command;
+    std::string compilerOutput;
+    std::string libraryPath;
+    // True when the library came out of the plugin cache instead of a compiler run
+    bool fromCache = false;
+    std::uint64_t cacheKey = 0;
+
+    // "g++ O3 + native (-O3 -march=native)": what the benchmark reports next to the plugin's timings.
+    std::string describe() const;
+};
+
+// Builds custom algorithm and structure sources into shared objects with a selectable optimisation
+// profile, so plugins are measured with the same kind of flags as the built-in code.
+class PluginCompiler {
+public:
+    // Profile-guided optimisation stage layered on top of the build profile.
+    enum class ProfileGuidance {
+        NONE,
+        // Instrumented build that writes .gcda files into the profile directory when it is unloaded
+        GENERATE,
+        // Optimised build that reads the .gcda files back
+        USE
+    };
+
+private:
+    std::string compiler = "g++";
+    BuildProfile profile = BuildProfile::O2;
+    std::string customFlags;
+    ProfileGuidance guidance = ProfileGuidance::NONE;
+    std::string profileDirectory;
+
+public:
+    // Compiler executable (g++ by default); returns false for names containing whitespace or shell metacharacters.
+    bool setCompiler(const std::string& executable);
+    // Compiler executable used by compile().
+    const std::string& getCompiler() const;
+    // Chooses the profile for the following builds.
+    void setProfile(BuildProfile newProfile);
+    // Profile used by compile().
+    BuildProfile getProfile() const;
+    // Flags of the CUSTOM profile; returns false (keeping the old ones) if they contain shell metacharacters.
+    bool setCustomFlags(const std::string& flags);
+    // Turns profile-guided optimisation on for the following builds. GCC names the profile data after the
+    // library path, so the GENERATE and USE builds must be compiled into the same output directory.
+    void setProfileGuidance(ProfileGuidance stage, const std::string& directory);
+    // Current profile-guided optimisation stage.
+    ProfileGuidance getProfileGuidance() const;
+    // Optimisation flags the current profile (and PGO stage) adds to the base command.
+    std::string profileFlags() const;
+
+    // Compiles sourcePath into <outputDirectory>/<stem>_<profile>_custom.so. The profile (with a hash of the
+    // flags for CUSTOM) is part of the file name so a plugin built twice with different flags never reuses
+    // the first build's handle.
+    PluginBuild compile(const std::string& sourcePath, const std::string& outputDirectory) const;
+    // Returns the cached library when the key matches, otherwise compiles into the cache. PGO builds depend
+    // on profile data outside the key, so they bypass the cache and go to the plain overload's directory. The entry is
+    // built in a private directory and renamed into place, so concurrent jobs never load a partial file.
+    PluginBuild compile(const std::string& sourcePath, const PluginCache& cache) const;
+    // Cache key of a source under the current compiler and profile.
+    std::uint64_t cacheKey(const std::string& sourcePath) const;
+
+    // Short label of a profile ("debug", "O2", "O3 + native", "LTO", "custom").
+    static std::string profileName(BuildProfile profile);
+    // Maps menu text (debug, o2, o3, native, lto, custom) to a profile.
+    static bool parseProfile(const std::string& text, BuildProfile& profile);
+    // True when "<compiler> --version" runs successfully.
+    static bool isCompilerAvailable(const std::string& executable);
+    // How the host binary itself was compiled, as far as the predefined macros tell.
+    static std::string hostBuildDescription();
+};
@@ -0,0 +1,65 @@
+// include/manager/PluginMatrix.hpp
+#pragma once
+#include <string>
+#include <vector>
+#include "BenchmarkManager.hpp"
+#include "BenchmarkScheduler.hpp"
+#include "PluginCompiler.hpp"
+
+// One compiler and flag combination of a matrix.
+struct PluginVariant {
+    std::string compiler = "g++";
+    BuildProfile profile = BuildProfile::O2;
+    // Only used by the CUSTOM profile
+    std::string customFlags;
+
+    // "clang++ O3 + native" or "g++ -O2 -funroll-loops".
+    std::string label() const;
+};
+
+// Build and timing of one variant.
+struct PluginVariantResult {
+    PluginVariant variant;
+    PluginBuild build;
+    // Wall time of the build (close to zero on a cache hit)
+    double buildMs = 0.0;
+    bool loaded = false;
+    // getName() of the loaded variant
+    std::string algorithmName;
+    ExecutionSample sample;
+};
+
+// Builds one custom algorithm with several compilers and flag sets, then runs every variant on the same
+// input through AlgorithmFactory and tabulates time and OS counters side by side.
+class PluginMatrix {
+private:
+    std::vector<PluginVariant> variants;
+    int repetitions = 5;
+    // Cache directory for the builds; empty uses PluginCache's default
+    std::string cacheDirectory;
+    // Times the variants concurrently when set; null times them one after another through the manager
+    const BenchmarkScheduler* scheduler = nullptr;
+
+public:
+    // Adds a variant; returns false (and skips it) when the compiler name or custom flags are rejected.
+    bool addVariant(const PluginVariant& variant);
+    // Variants in the order they were added.
+    const std::vector<PluginVariant>& getVariants() const;
+    // Timed runs per variant.
+    void setRepetitions(int count);
+    // Where builds are cached (mainly for tests).
+    void setCacheDirectory(const std::string& directory);
+    // Hands the timing runs to a scheduler (owned by the caller). Every variant is then loaded at once,
+    // which RTLD_LOCAL and -Bsymbolic keep apart, and unloaded after the batch.
+    void setScheduler(const BenchmarkScheduler* batchScheduler);
+
+    // Adds O2 and O3 + native for every installed compiler among g++ and clang++.
+    void addStandardVariants();
+
+    // Compiles every variant in parallel on a pool with one thread per variant, then times them on ds once
+    // every build has finished, so no timing shares the CPU with a compiler. Without a scheduler, each variant
+    // is loaded, timed through benchmarkManager and unloaded before the next one. With a scheduler, all
+    // variants are loaded together, timed as one batch and unloaded afterwards. Libraries the session
+    // already holds stay loaded in both modes. Prints the table.
+    std::vector<PluginVariantResult> run(const std::string& sourcePath, DataStructure* ds, BenchmarkManager& benchmarkManager) const;
+};
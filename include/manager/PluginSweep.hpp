@@ -0,0 +1,42 @@
+// include/manager/PluginSweep.hpp
+#pragma once
+#include <string>
+#include <vector>
+#include "BenchmarkManager.hpp"
+#include "BenchmarkScheduler.hpp"
+#include "../model/PluginRegistry.hpp"
+
+// Timing of one registered algorithm on one structure.
+struct PluginSweepResult {
+    // Registered structure label, or the name of the structure passed to run()
+    std::string structure;
+    RegisteredEntry algorithm;
+    bool loaded = false;
+    ExecutionSample sample;
+};
+
+// Runs every algorithm a plugin registers, on every structure another (or the same) plugin registers,
+// in one process: each library is opened once and each variant is only an instance away.
+class PluginSweep {
+private:
+    int repetitions = 5;
+    // Runs the pairs concurrently when set; null times them one after another through the manager
+    const BenchmarkScheduler* scheduler = nullptr;
+    // Registered algorithm names whose pairs the scheduler runs alone, after the concurrent ones
+    std::vector<std::string> serialAlgorithms;
+
+public:
+    // Timed runs per pair.
+    void setRepetitions(int count);
+    // Hands the pairs to a scheduler (owned by the caller) instead of timing them one by one.
+    void setScheduler(const BenchmarkScheduler* batchScheduler);
+    // Marks algorithms (by registered name) as memory-bandwidth bound, so a scheduled sweep does not run
+    // their pairs next to others.
+    void setSerialAlgorithms(const std::vector<std::string>& names);
+
+    // Sweeps the algorithms of algorithmLibrary. With a structureLibrary that registers structures, each
+    // of them is filled with ds's elements and swept in turn; otherwise ds itself is used. Libraries
+    // without a registry contribute their single default entry. Prints the table, fastest first.
+    std::vector<PluginSweepResult> run(const std::string& algorithmLibrary, DataStructure* ds,
+                                       BenchmarkManager& benchmarkManager, const std::string& structureLibrary = "") const;
+};
@@ -0,0 +1,52 @@
+// include/manager/PluginWatcher.hpp
+#pragma once
+#include <atomic>
+#include <string>
+#include <vector>
+#include "BenchmarkManager.hpp"
+#include "PluginCompiler.hpp"
+
+// Outcome of one rebuild in watch mode.
+struct WatchIteration {
+    // 1 for the initial build, then one more per detected change
+    int number = 0;
+    PluginBuild build;
+    bool loaded = false;
+    // getName() of the loaded build, which shows the edit that produced it took effect
+    std::string algorithmName;
+    ExecutionSample sample;
+    // Change of the best time against the previous build that ran; 0 for the first one
+    double deltaPercent = 0.0;
+};
+
+// Edit-measure loop for a custom algorithm: waits for the source to be saved (inotify on Linux,
+// modification-time polling elsewhere), rebuilds it through the plugin cache, swaps the loaded
+// library in AlgorithmFactory and re-runs the benchmark on the same structure.
+class PluginWatcher {
+private:
+    PluginCompiler compiler;
+    int repetitions = 5;
+    // Cache directory for the builds; empty uses PluginCache's default
+    std::string cacheDirectory;
+    bool stopOnEnter = false;
+    std::atomic<bool> stopRequested{false};
+
+public:
+    // Builds with the given compiler settings (profile, flags, compiler).
+    explicit PluginWatcher(const PluginCompiler& pluginCompiler);
+
+    // Timed runs per build.
+    void setRepetitions(int count);
+    // Where builds are cached (mainly for tests).
+    void setCacheDirectory(const std::string& directory);
+    // Lets a line on standard input end the loop (Linux only; used by the interactive CLI).
+    void setStopOnEnter(bool enabled);
+    // Ends watch() after the current iteration; safe to call from another thread.
+    void stop();
+
+    // Builds and benchmarks once, then again after every change, until stop(), Enter (when enabled) or
+    // maxBuilds builds (0 for no limit). The library of the last build is unloaded on return. A library the
+    // caller already holds is reused as it is, so callers unload their own build of the source first.
+    std::vector<WatchIteration> watch(const std::string& sourcePath, DataStructure* ds, BenchmarkManager& benchmarkManager,
+                                      int maxBuilds = 0);
+};
@@ -1,14 +1,23 @@
 // include/model/Algorithm.hpp
 #pragma once
+#include <cstddef>
 #include <string>
 #include "DataStructure.hpp"
+#include "../core/ExecutionContext.hpp"
 
 // Base interface for all algorithms
 class Algorithm {
+protected:
+    // Runtime services from the benchmark (thread pool); null until setExecutionContext is called.
+    ExecutionContext* context = nullptr;
+
 public:
     // Virtual destructor for proper cleanup of derived classes
     virtual ~Algorithm() = default;
 
+    // Builds any input the timed run depends on (pre-sorted runs, scratch files) so it stays out of the timing.
+    virtual void prepare(DataStructure* ds) { (void)ds; }
+
     // Base methods to be implemented by derived algorithm classes
     // Runs the algorithm silently so benchmarks only capture timing.
     virtual void execute(DataStructure* ds) = 0;
@@ -19,4 +28,18 @@ public:
 
     // For returning the name of the algorithm when benchmarking.
     virtual std::string getName() const = 0;
+
+    // Number of times execute() runs the kernel, so benchmarks can report per-run time.
+    virtual std::size_t getRepetitions() const { return 1; }
+
+    // Hands over the shared runtime; parallel algorithms queue their work on its pool.
+    virtual void setExecutionContext(ExecutionContext* executionContext) { context = executionContext; }
+
+    // True when execute() can spread its work over the thread pool; such algorithms take part in scaling sweeps.
+    virtual bool isParallel() const { return false; }
+
+    // Number of tasks a parallel algorithm splits its work into (ignored by serial ones).
+    virtual void setThreadCount(unsigned threads) { (void)threads; }
+    // Current task count; 1 for serial algorithms.
+    virtual unsigned getThreadCount() const { return 1; }
 };
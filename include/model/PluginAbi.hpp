@@ -0,0 +1,91 @@
+// include/model/PluginAbi.hpp
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Versioned C ABI for plugins that work on raw buffers instead of DataStructure objects.
+// The plugin exports RAYSTRUCT_PLUGIN_ENTRY, which returns a descriptor that stays valid while the
+// library is loaded. Only C types cross the boundary, so such plugins can be written in C or built
+// with a different compiler or standard library than the host. The major version is part of the
+// symbol name; later minor versions only append fields, and struct_size tells each side how much
+// of the other's struct it may read.
+
+#define RAYSTRUCT_PLUGIN_ABI_VERSION 1u
+#define RAYSTRUCT_PLUGIN_ENTRY "raystruct_plugin_v1"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Capabilities a plugin declares in RaystructPluginInfo::capabilities.
+enum RaystructCapability {
+    // run() sorts the buffer ascending in place.
+    RAYSTRUCT_CAP_SORT = 1u << 0,
+    // run() places the k-th smallest element at index k, smaller ones before it (nth_element contract).
+    RAYSTRUCT_CAP_SELECT = 1u << 1,
+    // Accepts 4-byte signed elements.
+    RAYSTRUCT_CAP_INT32 = 1u << 2,
+    // Accepts 8-byte signed elements.
+    RAYSTRUCT_CAP_INT64 = 1u << 3,
+    // run() may split its work with RaystructPool::run_tasks.
+    RAYSTRUCT_CAP_PARALLEL = 1u << 4
+};
+
+// What the host asks run() to do; only operations the plugin declared are requested.
+enum RaystructOperation {
+    RAYSTRUCT_OP_SORT = 0,
+    RAYSTRUCT_OP_SELECT = 1
+};
+
+// Body of one pool task; task is in [0, tasks).
+typedef void (*RaystructTaskFn)(void* arg, unsigned task);
+
+// Handle to the host's thread pool. run_tasks runs fn(arg, t) for every t, task 0 on the calling
+// thread, and returns when all of them have finished.
+typedef struct RaystructPool {
+    void* handle;
+    // Number of tasks the benchmark asked for; 1 means run serially.
+    unsigned threads;
+    void (*run_tasks)(void* handle, unsigned tasks, RaystructTaskFn fn, void* arg);
+} RaystructPool;
+
+// One invocation. The buffers belong to the host and are reused across calls, so run() must not
+// keep pointers to them or allocate on the hot path.
+typedef struct RaystructCall {
+    uint32_t struct_size;
+    // A RaystructOperation value.
+    uint32_t operation;
+    void* data;
+    size_t length;
+    // 4 or 8, matching one of the declared integer capabilities.
+    size_t element_width;
+    // Rank for RAYSTRUCT_OP_SELECT, below length.
+    size_t k;
+    // Arena of scratch_bytes bytes (the size the plugin asked for), aligned to 64 bytes.
+    void* scratch;
+    size_t scratch_bytes;
+    // Never null; threads is 1 when the run is serial.
+    const RaystructPool* pool;
+} RaystructCall;
+
+// Descriptor returned by the entry point.
+typedef struct RaystructPluginInfo {
+    // RAYSTRUCT_PLUGIN_ABI_VERSION the plugin was built against.
+    uint32_t abi_version;
+    // sizeof(RaystructPluginInfo) in the plugin's build.
+    uint32_t struct_size;
+    const char* name;
+    // Bitwise or of RaystructCapability values.
+    uint64_t capabilities;
+    // Scratch bytes needed for length elements of element_width bytes; may be null when none are used.
+    size_t (*scratch_bytes)(size_t length, size_t element_width);
+    // Runs one call; returns 0 on success, anything else is reported as an error code.
+    int (*run)(const RaystructCall* call);
+} RaystructPluginInfo;
+
+// Signature of RAYSTRUCT_PLUGIN_ENTRY.
+typedef const RaystructPluginInfo* (*RaystructPluginEntryFn)(void);
+
+#ifdef __cplusplus
+}
+#endif
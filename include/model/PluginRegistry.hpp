@@ -0,0 +1,78 @@
+// include/model/PluginRegistry.hpp
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Algorithm.hpp"
+#include "DataStructure.hpp"
+
+// Registry a plugin can export instead of (or next to) createAlgorithm/createDataStructure, so one
+// shared library can offer many named variants. The plugin defines
+//     extern "C" const PluginRegistry* raystructRegistry();
+// returning tables that stay valid while the library is loaded.
+
+#define RAYSTRUCT_REGISTRY_VERSION 1u
+#define RAYSTRUCT_REGISTRY_SYMBOL "raystructRegistry"
+
+// A setting the entry was built with, e.g. {"digitBits", "8"}; reported next to its timings.
+struct PluginParameter {
+    const char* name;
+    const char* value;
+};
+
+// One algorithm the library offers.
+struct PluginAlgorithmEntry {
+    const char* name;
+    Algorithm* (*create)();
+    const PluginParameter* parameters;
+    std::size_t parameterCount;
+};
+
+// One data structure the library offers.
+struct PluginStructureEntry {
+    const char* name;
+    DataStructure* (*create)();
+    const PluginParameter* parameters;
+    std::size_t parameterCount;
+};
+
+// Everything a library registers; either table may be empty.
+struct PluginRegistry {
+    std::uint32_t version;
+    const PluginAlgorithmEntry* algorithms;
+    std::size_t algorithmCount;
+    const PluginStructureEntry* structures;
+    std::size_t structureCount;
+};
+
+// Signature of RAYSTRUCT_REGISTRY_SYMBOL.
+using PluginRegistryFn = const PluginRegistry* (*)();
+
+// Host-side copy of a registry entry, so listings outlive the library tables.
+struct RegisteredEntry {
+    std::string name;
+    std::vector<std::pair<std::string, std::string>> parameters;
+
+    // Copies name and parameters out of a registry table entry.
+    template <typename Entry>
+    static RegisteredEntry from(const Entry& entry) {
+        RegisteredEntry copy;
+        copy.name = entry.name ? entry.name : "";
+        for (std::size_t i = 0; entry.parameters && i < entry.parameterCount; ++i) {
+            copy.parameters.emplace_back(entry.parameters[i].name ? entry.parameters[i].name : "",
+                                         entry.parameters[i].value ? entry.parameters[i].value : "");
+        }
+        return copy;
+    }
+
+    // "name (digitBits=8, unroll=4)", or just the name without parameters.
+    std::string label() const {
+        std::string text = name;
+        for (std::size_t i = 0; i < parameters.size(); ++i) {
+            text += (i == 0 ? " (" : ", ") + parameters[i].first + "=" + parameters[i].second;
+        }
+        return parameters.empty() ? text : text + ")";
+    }
+};
@@ -0,0 +1,35 @@
+// include/model/SelectionAlgorithm.hpp
+#pragma once
+#include "Algorithm.hpp"
+
+// Base class for k-th order statistic algorithms sharing the k and smallest/largest parameters
+class SelectionAlgorithm : public Algorithm {
+protected:
+    // Selection parameters
+    bool isSmallest = true;
+    int k = 1;
+    int result = 0;
+
+    // Returns the requested statistic; elements is a scratch copy the method may reorder.
+    virtual int select(std::vector<int>& elements) = 0;
+
+    // Prints the result to the console.
+    void display(const std::vector<int>& elements) override;
+
+public:
+    // Overrides from Algorithm
+    // Computes the statistic without printing.
+    void execute(DataStructure* ds) override;
+    // Computes the statistic and prints the result summary.
+    void executeAndDisplay(DataStructure* ds) override;
+
+    // Setters for parameters
+    // Chooses smallest (true) versus largest (false) search mode.
+    void setIsSmallest(bool choice);
+    // Sets which k value to retrieve.
+    void setK(int value);
+
+    // Helper for tests/UI to inspect the last computed result
+    // Provides access to the previously computed value.
+    int getResult() const;
+};
@@ -1,7 +1,9 @@
 // include/structure/DataStructureFactory.h
 #pragma once
 #include <string>
+#include <vector>
 #include "../model/DataStructure.hpp"
+#include "../model/PluginRegistry.hpp"
 #include "../structure/ListStructure.hpp"
 #include "../structure/HeapStructure.hpp"
 #include "../structure/GraphStructure.hpp"
@@ -10,7 +12,12 @@
 class DataStructureFactory {
 public:
     // Creates built-in data structures or custom ones when CUSTOM is requested.
+    // A library that only exports a registry yields its first registered structure.
     static DataStructure* createDataStructure(DataStructureEnum type, const std::string& customLibraryPath = "");
+    // Creates the structure registered under entryName; null when the library has no such entry.
+    static DataStructure* createCustomDataStructure(const std::string& customLibraryPath, const std::string& entryName);
+    // Lists the structures a library registers (empty without a registry); false when it cannot be loaded.
+    static bool listCustomDataStructures(const std::string& customLibraryPath, std::vector<RegisteredEntry>& entries);
     // Clears all dynamically loaded custom data structure libraries.
     static void cleanupCustomLibraries();
 };
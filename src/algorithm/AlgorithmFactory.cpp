@@ -56,7 +56,9 @@ LibraryHandle openLibrary(const std::string& path, std::string& error) {
     }
     return handle;
 #else
-    LibraryHandle handle = dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    // RTLD_LOCAL keeps the library's symbols out of the global scope, so two builds of one source loaded
+    // side by side each bind to their own code
+    LibraryHandle handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
     if (!handle) {
         const char* err = dlerror();
         error = err ? err : "Unknown error";
@@ -102,6 +104,10 @@ struct CustomLibraryInfo {
     LibraryHandle handle = nullptr;
     using CreateFn = Algorithm* (*)();
     CreateFn create = nullptr;
+    // Set instead of create when the library exports the raw-buffer ABI
+    const RaystructPluginInfo* rawPlugin = nullptr;
+    // Named variants, when the library exports a registry
+    const PluginRegistry* registry = nullptr;
     bool ownsFile = false;
 };
 
@@ -132,6 +138,73 @@ bool shouldOwnLibraryFile(const std::string& pathStr) {
     auto parent = path.parent_path().filename();
     return parent == "algorithm";
 }
+// Opens the library on first use and works out which entry points it provides; null when unusable.
+CustomLibraryInfo* loadCustomLibrary(const std::string& customLibraryPath) {
+    // Check if the library is already loaded
+    auto& libraries = customLibraries();
+    auto it = libraries.find(customLibraryPath);
+    if (it != libraries.end()) {
+        return &it->second;
+    }
+
+    // Load the shared library
+    CustomLibraryInfo info;
+    std::string loadError;
+    info.handle = openLibrary(customLibraryPath, loadError);
+    if (!info.handle) {
+        std::cerr << "Failed to load custom algorithm library '"
+                  << customLibraryPath << "': " << loadError << std::endl;
+        return nullptr;
+    }
+
+    // Prefer the raw-buffer entry point, then the registry and the createAlgorithm factory
+    std::string symbolError;
+    auto entry = reinterpret_cast<RaystructPluginEntryFn>(
+        loadSymbol(info.handle, RAYSTRUCT_PLUGIN_ENTRY, symbolError));
+    if (entry) {
+        info.rawPlugin = entry();
+        std::string abiError;
+        if (!RawBufferAlgorithm::isUsable(info.rawPlugin, abiError)) {
+            std::cerr << "Custom library '" << customLibraryPath << "' exports " << RAYSTRUCT_PLUGIN_ENTRY
+                      << " but cannot be used: " << abiError << std::endl;
+            closeLibrary(info.handle);
+            return nullptr;
+        }
+    } else {
+        auto registryFn = reinterpret_cast<PluginRegistryFn>(
+            loadSymbol(info.handle, RAYSTRUCT_REGISTRY_SYMBOL, symbolError));
+        if (registryFn) {
+            info.registry = registryFn();
+            if (!info.registry || info.registry->version != RAYSTRUCT_REGISTRY_VERSION) {
+                std::cerr << "Custom library '" << customLibraryPath << "' exports a registry of an unsupported version."
+                          << std::endl;
+                closeLibrary(info.handle);
+                return nullptr;
+            }
+        }
+        info.create = reinterpret_cast<CustomLibraryInfo::CreateFn>(
+            loadSymbol(info.handle, "createAlgorithm", symbolError));
+        if (!info.create && (!info.registry || info.registry->algorithmCount == 0)) {
+            std::cerr << "Failed to locate createAlgorithm, " << RAYSTRUCT_REGISTRY_SYMBOL << " or "
+                      << RAYSTRUCT_PLUGIN_ENTRY << " in '" << customLibraryPath << "': " << symbolError << std::endl;
+            closeLibrary(info.handle);
+            return nullptr;
+        }
+    }
+
+    // Store the loaded library info
+    info.ownsFile = shouldOwnLibraryFile(customLibraryPath);
+    return &libraries.emplace(customLibraryPath, info).first->second;
+}
+
+// Runs a factory function and reports a null result.
+Algorithm* instantiate(Algorithm* (*create)(), const std::string& customLibraryPath) {
+    Algorithm* instance = create ? create() : nullptr;
+    if (!instance) {
+        std::cerr << "Custom algorithm factory returned nullptr from '" << customLibraryPath << "'." << std::endl;
+    }
+    return instance;
+}
 } // namespace
 
 // Instantiates built-in algorithms or dlopens a custom shared object on demand.
@@ -141,14 +214,36 @@ Algorithm* AlgorithmFactory::createAlgorithm(AlgorithmEnum type, const std::stri
             return new InsertionSort();
         case AlgorithmEnum::MERGE_SORT: 
             return new MergeSort();
+        case AlgorithmEnum::EXTERNAL_MERGE_SORT:
+            return new ExternalMergeSort();
+        case AlgorithmEnum::KWAY_MERGE:
+            return new KWayMerge();
         case AlgorithmEnum::HEAP_BUILD: 
             return new HeapBuild();
         case AlgorithmEnum::HEAP_SELECTION:
             return new HeapSelection();
+        case AlgorithmEnum::QUICK_SELECT:
+            return new QuickSelect();
+        case AlgorithmEnum::SIMD_SELECTION:
+            return new SimdSelection();
+        case AlgorithmEnum::STREAMING_SELECTION:
+            return new StreamingSelection();
+        case AlgorithmEnum::PARALLEL_SELECTION:
+            return new ParallelSelection();
         case AlgorithmEnum::A_STAR: 
             return new AStar();
         case AlgorithmEnum::PRIMS: 
             return new Prims();
+        case AlgorithmEnum::SIMD_SORT:
+            return new SimdSort();
+        case AlgorithmEnum::RADIX_SORT:
+            return new LsdRadixSort();
+        case AlgorithmEnum::STD_SORT:
+            return new StdSort();
+        case AlgorithmEnum::PDQ_SORT:
+            return new PdqSort();
+        case AlgorithmEnum::SORTING_NETWORK:
+            return new SortingNetworkSort();
         case AlgorithmEnum::CUSTOM:
             // Load custom algorithm from shared library
             if (customLibraryPath.empty()) {
@@ -156,54 +251,79 @@ Algorithm* AlgorithmFactory::createAlgorithm(AlgorithmEnum type, const std::stri
                 return nullptr;
             }
             {
-                // Check if the library is already loaded
-                auto& libraries = customLibraries();
-                auto it = libraries.find(customLibraryPath);
-                if (it == libraries.end()) {
-                    // Load the shared library
-                    CustomLibraryInfo info;
-                    std::string loadError;
-                    info.handle = openLibrary(customLibraryPath, loadError);
-                    if (!info.handle) {
-                        std::cerr << "Failed to load custom algorithm library '"
-                                  << customLibraryPath << "': " << loadError << std::endl;
-                        return nullptr;
-                    }
-
-                    // Locate the factory function symbol
-                    std::string symbolError;
-                    info.create = reinterpret_cast<CustomLibraryInfo::CreateFn>(
-                        loadSymbol(info.handle, "createAlgorithm", symbolError));
-                    if (!info.create) {
-                        std::cerr << "Failed to locate createAlgorithm in '" << customLibraryPath
-                                  << "': " << symbolError << std::endl;
-                        closeLibrary(info.handle);
-                        return nullptr;
-                    }
-                    
-                    // Store the loaded library info
-                    info.ownsFile = shouldOwnLibraryFile(customLibraryPath);
-                    it = libraries.emplace(customLibraryPath, info).first;
-                }
-
-                // Use the factory function to create an instance
-                if (!it->second.create) {
-                    std::cerr << "Custom library '" << customLibraryPath << "' did not provide a valid createAlgorithm symbol." << std::endl;
+                CustomLibraryInfo* info = loadCustomLibrary(customLibraryPath);
+                if (!info) {
                     return nullptr;
                 }
 
-                // Create and return the algorithm instance
-                Algorithm* instance = it->second.create();
-                if (!instance) {
-                    std::cerr << "Custom algorithm factory returned nullptr from '" << customLibraryPath << "'." << std::endl;
+                // Raw-ABI libraries are driven through the adapter
+                if (info->rawPlugin) {
+                    return new RawBufferAlgorithm(info->rawPlugin);
                 }
-                return instance;
+
+                // createAlgorithm wins when present; registry-only libraries default to their first entry
+                return instantiate(info->create ? info->create : info->registry->algorithms[0].create, customLibraryPath);
             }
         default:
             return nullptr;
     }
 }
 
+// Looks the entry up by name in the library's registry.
+Algorithm* AlgorithmFactory::createCustomAlgorithm(const std::string& customLibraryPath, const std::string& entryName) {
+    CustomLibraryInfo* info = loadCustomLibrary(customLibraryPath);
+    if (!info) {
+        return nullptr;
+    }
+
+    const PluginRegistry* registry = info->registry;
+    for (std::size_t i = 0; registry && i < registry->algorithmCount; ++i) {
+        if (registry->algorithms[i].name && entryName == registry->algorithms[i].name) {
+            return instantiate(registry->algorithms[i].create, customLibraryPath);
+        }
+    }
+    std::cerr << "Custom library '" << customLibraryPath << "' registers no algorithm named '" << entryName << "'." << std::endl;
+    return nullptr;
+}
+
+// Copies the registry's algorithm table; libraries without a registry list nothing.
+bool AlgorithmFactory::listCustomAlgorithms(const std::string& customLibraryPath, std::vector<RegisteredEntry>& entries) {
+    entries.clear();
+    CustomLibraryInfo* info = loadCustomLibrary(customLibraryPath);
+    if (!info) {
+        return false;
+    }
+
+    const PluginRegistry* registry = info->registry;
+    for (std::size_t i = 0; registry && i < registry->algorithmCount; ++i) {
+        entries.push_back(RegisteredEntry::from(registry->algorithms[i]));
+    }
+    return true;
+}
+
+// Only reports the factory's own cache; it does not open anything.
+bool AlgorithmFactory::isCustomLibraryLoaded(const std::string& customLibraryPath) {
+    return customLibraries().count(customLibraryPath) != 0;
+}
+
+// Closing the handle runs the library's destructors, which is also when instrumented builds write their
+// profile data. A kept file is owned again by whichever load opens it next.
+bool AlgorithmFactory::unloadCustomLibrary(const std::string& customLibraryPath, bool keepFile) {
+    auto& libraries = customLibraries();
+    auto it = libraries.find(customLibraryPath);
+    if (it == libraries.end()) {
+        return false;
+    }
+
+    closeLibrary(it->second.handle);
+    if (it->second.ownsFile && !keepFile) {
+        std::error_code ec;
+        std::filesystem::remove(customLibraryPath, ec);
+    }
+    libraries.erase(it);
+    return true;
+}
+
 // Clears every custom library handle and optionally deletes temporary .so files.
 void AlgorithmFactory::cleanupCustomLibraries() {
     // Unload all custom libraries and delete files if owned
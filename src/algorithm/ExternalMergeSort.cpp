@@ -0,0 +1,427 @@
+// src/algorithm/ExternalMergeSort.cpp
+#include "../../include/algorithm/ExternalMergeSort.hpp"
+#include "../../include/algorithm/LoserTree.hpp"
+#include "../../include/algorithm/SimdKernels.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+// Namespace for internal linkage
+namespace {
+// Smallest budget accepted, so that a two-way merge still gets useful buffers.
+constexpr std::size_t kMinBudgetElements = 1024;
+// Merge buffers below this size turn the merge into random I/O, so the fan-in is capped to keep them larger.
+constexpr std::size_t kMinReadAheadElements = std::size_t(1) << 16;
+// SimdKernels::sort allocates a scratch buffer of n + kSortPadding keys next to the run it sorts.
+constexpr std::size_t kSortPadding = 8;
+
+// Distinguishes scratch files of runs started by different instances or at different times.
+std::atomic<std::uint64_t> nextRunId{0};
+
+// Sequential reader over a run file with a large read-ahead buffer.
+class RunReader {
+private:
+    std::ifstream file;
+    std::vector<int> buffer;
+    std::size_t position = 0;
+    std::size_t filled = 0;
+    std::uint64_t& bytesRead;
+
+    std::string path;
+
+    // Pulls the next buffer-full from the file; only a clean end of file may come up short.
+    void refill() {
+        file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(int)));
+        const std::size_t bytes = static_cast<std::size_t>(file.gcount());
+        if (file.bad() || (!file && !file.eof()) || bytes % sizeof(int) != 0) {
+            throw std::runtime_error("Read error in run file " + path + ".");
+        }
+        filled = bytes / sizeof(int);
+        position = 0;
+        bytesRead += filled * sizeof(int);
+    }
+
+public:
+    RunReader(const std::string& runPath, std::size_t bufferElements, std::uint64_t& bytesRead)
+        : file(runPath, std::ios::binary), buffer(bufferElements), bytesRead(bytesRead), path(runPath) {
+        if (!file) {
+            throw std::runtime_error("Cannot open run file " + path + ".");
+        }
+        refill();
+    }
+
+    // True while a key is available.
+    bool valid() const {
+        return position < filled;
+    }
+
+    // The current key.
+    int peek() const {
+        return buffer[position];
+    }
+
+    // Moves to the next key, refilling when the buffer runs dry.
+    void advance() {
+        if (++position == filled) {
+            refill();
+        }
+    }
+};
+
+// Sequential writer that flushes whole buffers. close() must be called to finish a file: it is the
+// point where a full disk shows up, and a destructor cannot report it.
+class RunWriter {
+private:
+    std::ofstream file;
+    std::vector<int> buffer;
+    std::size_t filled = 0;
+    std::uint64_t& bytesWritten;
+    std::string path;
+
+    // Turns a failed stream into an exception naming the file.
+    void check() {
+        if (!file) {
+            throw std::runtime_error("Write error in " + path + " (disk full?).");
+        }
+    }
+
+public:
+    RunWriter(const std::string& outputPath, std::size_t bufferElements, std::uint64_t& bytesWritten)
+        : file(outputPath, std::ios::binary | std::ios::trunc), buffer(bufferElements), bytesWritten(bytesWritten),
+          path(outputPath) {}
+
+    // False when the file could not be created.
+    bool ok() const {
+        return static_cast<bool>(file);
+    }
+
+    // Appends one key.
+    void push(int value) {
+        buffer[filled++] = value;
+        if (filled == buffer.size()) {
+            flush();
+        }
+    }
+
+    // Appends a block of keys directly, bypassing the buffer.
+    void write(const int* data, std::size_t n) {
+        flush();
+        file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(n * sizeof(int)));
+        check();
+        bytesWritten += n * sizeof(int);
+    }
+
+    // Writes out whatever is buffered.
+    void flush() {
+        if (filled > 0) {
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(filled * sizeof(int)));
+            check();
+            bytesWritten += filled * sizeof(int);
+            filled = 0;
+        }
+    }
+
+    // Writes the rest and closes the file, throwing if any of it did not reach the disk.
+    void close() {
+        flush();
+        file.close();
+        check();
+    }
+};
+
+// Length of a binary int32 file in elements, or 0 when it cannot be opened.
+std::size_t fileElements(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return 0;
+    }
+    return static_cast<std::size_t>(file.tellg()) / sizeof(int);
+}
+
+// Deletes scratch files left behind by a failed phase; errors are ignored since one is already in flight.
+void removeQuietly(const std::vector<std::string>& paths) {
+    for (const std::string& path : paths) {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+}
+
+// Seconds elapsed since start.
+double secondsSince(std::chrono::high_resolution_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+}
+} // namespace
+
+// Starts with the widest instruction set available on this machine.
+ExternalMergeSort::ExternalMergeSort() : level(SimdKernels::detectLevel()) {}
+
+// Budget in keys, with a floor so tiny budgets still make progress.
+std::size_t ExternalMergeSort::budgetElements() const {
+    return std::max(kMinBudgetElements, memoryBudget / sizeof(int));
+}
+
+// Scratch files live in the configured directory (or the system temp directory).
+std::string ExternalMergeSort::scratchPath(const std::string& tag, std::size_t index) const {
+    std::filesystem::path directory = tempDirectory.empty() ? std::filesystem::temp_directory_path()
+                                                            : std::filesystem::path(tempDirectory);
+    return (directory / ("raystruct_extsort_" + tag + "_" + std::to_string(index) + ".bin")).string();
+}
+
+// The in-memory sort needs a scratch buffer as large as the run, so a run takes half of the budget and
+// there are ceil(2n / budget) of them. When the input fits in one run it is written straight to the
+// destination and no merge is needed.
+std::vector<std::string> ExternalMergeSort::generateRuns(DataStructure* ds, const std::string& destination) {
+    const std::size_t runElements = std::max<std::size_t>(1, (budgetElements() - kSortPadding) / 2);
+    const std::string tag = std::to_string(nextRunId++);
+
+    std::vector<int> structureElements;
+    std::ifstream input;
+    std::size_t total = 0;
+    if (source == Source::FILE) {
+        input.open(inputPath, std::ios::binary);
+        total = fileElements(inputPath);
+    } else {
+        structureElements = ds->getElements();
+        total = structureElements.size();
+    }
+
+    std::vector<std::string> runs;
+    std::vector<int> run(std::min(runElements, std::max<std::size_t>(1, total)));
+    try {
+        for (std::size_t begin = 0; begin < total; begin += runElements) {
+            const std::size_t count = std::min(runElements, total - begin);
+            if (source == Source::FILE) {
+                input.read(reinterpret_cast<char*>(run.data()), static_cast<std::streamsize>(count * sizeof(int)));
+                if (static_cast<std::size_t>(input.gcount()) != count * sizeof(int)) {
+                    throw std::runtime_error("Read error in input file " + inputPath + " after " +
+                                             std::to_string(begin + static_cast<std::size_t>(input.gcount()) / sizeof(int)) + " keys.");
+                }
+                bytesRead += count * sizeof(int);
+            } else {
+                std::copy(structureElements.begin() + begin, structureElements.begin() + begin + count, run.begin());
+            }
+
+            SimdKernels::sort(run.data(), count, level);
+
+            runs.push_back(total <= runElements ? destination : scratchPath(tag + "_0", runs.size()));
+            RunWriter writer(runs.back(), 1, bytesWritten);
+            writer.write(run.data(), count);
+            writer.close();
+        }
+
+        if (runs.empty()) {
+            RunWriter(destination, 1, bytesWritten).close();
+        }
+    } catch (...) {
+        removeQuietly(runs);
+        throw;
+    }
+    elementsSorted = total;
+    return runs;
+}
+
+// The budget is shared by one read-ahead buffer per input run plus the output buffer, and a loser tree
+// picks the next key. The fan-in is capped so each buffer keeps at least kMinReadAheadElements keys
+// (or two runs on tiny budgets); more runs than that are merged in groups over several passes.
+void ExternalMergeSort::mergeRuns(std::vector<std::string> runs, const std::string& destination) {
+    const std::size_t budget = budgetElements();
+    const std::size_t maxFanIn = std::max<std::size_t>(3, budget / kMinReadAheadElements) - 1;
+    const std::string tag = std::to_string(nextRunId++);
+
+    while (runs.size() > 1) {
+        ++mergePasses;
+        const bool finalPass = runs.size() <= maxFanIn;
+        std::vector<std::string> merged;
+
+        try {
+            for (std::size_t group = 0; group < runs.size(); group += maxFanIn) {
+                const std::size_t fanIn = std::min(maxFanIn, runs.size() - group);
+                const std::size_t bufferElements = std::max<std::size_t>(1, budget / (fanIn + 1));
+
+                merged.push_back(finalPass ? destination : scratchPath(tag + "_" + std::to_string(mergePasses), merged.size()));
+                {
+                    std::vector<std::unique_ptr<RunReader>> readers;
+                    LoserTree tree(fanIn);
+                    for (std::size_t r = 0; r < fanIn; ++r) {
+                        readers.push_back(std::make_unique<RunReader>(runs[group + r], bufferElements, bytesRead));
+                        if (readers.back()->valid()) {
+                            tree.setLeaf(r, readers.back()->peek());
+                        }
+                    }
+                    tree.build();
+
+                    RunWriter writer(merged.back(), bufferElements, bytesWritten);
+                    while (!tree.empty()) {
+                        const std::size_t r = tree.winner();
+                        writer.push(tree.winnerKey());
+                        readers[r]->advance();
+                        if (readers[r]->valid()) {
+                            tree.replaceWinner(readers[r]->peek());
+                        } else {
+                            tree.retireWinner();
+                        }
+                    }
+                    writer.close();
+                }
+
+                for (std::size_t r = 0; r < fanIn; ++r) {
+                    std::filesystem::remove(runs[group + r]);
+                }
+            }
+        } catch (...) {
+            // Inputs already merged are gone; whatever is left of both lists is scratch (or a partial output)
+            removeQuietly(runs);
+            removeQuietly(merged);
+            throw;
+        }
+        runs = std::move(merged);
+    }
+}
+
+// Validates the source, then times run generation and merging separately. I/O errors in either phase
+// are reported, mark the run invalid and propagate as std::runtime_error.
+void ExternalMergeSort::sortToFile(DataStructure* ds, const std::string& destination) {
+    elementsSorted = 0;
+    runCount = 0;
+    mergePasses = 0;
+    bytesRead = 0;
+    bytesWritten = 0;
+    runSeconds = 0.0;
+    mergeSeconds = 0.0;
+
+    lastRunValid = source != Source::FILE || static_cast<bool>(std::ifstream(inputPath, std::ios::binary));
+    if (!lastRunValid) {
+        std::cerr << "Cannot open input file " << inputPath << "." << std::endl;
+        return;
+    }
+    if (!RunWriter(destination, 1, bytesWritten).ok()) {
+        std::cerr << "Cannot create output file " << destination << "." << std::endl;
+        lastRunValid = false;
+        return;
+    }
+
+    try {
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<std::string> runs = generateRuns(ds, destination);
+        runCount = runs.size();
+        runSeconds = secondsSince(start);
+
+        start = std::chrono::high_resolution_clock::now();
+        mergeRuns(std::move(runs), destination);
+        mergeSeconds = secondsSince(start);
+    } catch (const std::exception& error) {
+        // A partial output must not pass for a sorted one
+        std::cerr << error.what() << std::endl;
+        lastRunValid = false;
+        throw;
+    }
+}
+
+// Sorts into the output file; a scratch output is deleted afterwards, also when an I/O error propagates.
+void ExternalMergeSort::execute(DataStructure* ds) {
+    const std::string destination = outputPath.empty() ? scratchPath("out", nextRunId++) : outputPath;
+    try {
+        sortToFile(ds, destination);
+    } catch (...) {
+        if (outputPath.empty()) {
+            removeQuietly({destination});
+        }
+        throw;
+    }
+    if (outputPath.empty()) {
+        std::filesystem::remove(destination);
+    }
+}
+
+// Sorting happens on disk, so the statistics are shown instead of the keys.
+void ExternalMergeSort::executeAndDisplay(DataStructure* ds) {
+    try {
+        execute(ds);
+    } catch (const std::exception&) {
+        // sortToFile has printed the error; display() reports that there is no result
+    }
+    display({});
+}
+
+// Prints the phase times and the I/O volume of the last run.
+void ExternalMergeSort::display(const std::vector<int>& elements) {
+    (void)elements;
+    if (!lastRunValid) {
+        std::cout << "No result: the external sort did not run." << std::endl;
+        return;
+    }
+
+    const double mib = 1024.0 * 1024.0;
+    std::cout << "Sorted " << elementsSorted << " keys with a " << memoryBudget / mib << " MiB budget" << std::endl;
+    std::cout << "  Run generation: " << runSeconds * 1000.0 << "ms (" << runCount << " run(s), "
+              << SimdKernels::levelName(level) << " in-memory sort)" << std::endl;
+    std::cout << "  Merge:          " << mergeSeconds * 1000.0 << "ms (" << mergePasses << " pass(es))" << std::endl;
+    std::cout << "  I/O:            " << bytesRead / mib << " MiB read, " << bytesWritten / mib << " MiB written" << std::endl;
+    if (!outputPath.empty()) {
+        std::cout << "  Output:         " << outputPath << std::endl;
+    }
+}
+
+// Returns the algorithm's name with its configuration.
+std::string ExternalMergeSort::getName() const {
+    std::string name = "External Merge Sort (";
+    name += source == Source::FILE ? "file " + inputPath : std::string("structure");
+    return name + ", " + std::to_string(memoryBudget >> 10) + " KiB budget)";
+}
+
+// Sorts the benchmarked structure.
+void ExternalMergeSort::useStructure() {
+    source = Source::STRUCTURE;
+}
+
+// Sorts a binary file of 32-bit integers.
+void ExternalMergeSort::setInputFile(const std::string& path) {
+    source = Source::FILE;
+    inputPath = path;
+}
+
+// Stores the output path (empty for a scratch output).
+void ExternalMergeSort::setOutputFile(const std::string& path) {
+    outputPath = path;
+}
+
+// Stores the directory for run files.
+void ExternalMergeSort::setTempDirectory(const std::string& path) {
+    tempDirectory = path;
+}
+
+// Stores the memory budget in bytes.
+void ExternalMergeSort::setMemoryBudget(std::size_t bytes) {
+    memoryBudget = bytes;
+}
+
+// Getter for the key count of the last run.
+std::size_t ExternalMergeSort::getElementsSorted() const {
+    return elementsSorted;
+}
+
+// Getter for the run count of the last run.
+std::size_t ExternalMergeSort::getRunCount() const {
+    return runCount;
+}
+
+// Getter for the merge pass count of the last run.
+std::size_t ExternalMergeSort::getMergePasses() const {
+    return mergePasses;
+}
+
+// Getter for the bytes read by the last run.
+std::uint64_t ExternalMergeSort::getBytesRead() const {
+    return bytesRead;
+}
+
+// Getter for the bytes written by the last run.
+std::uint64_t ExternalMergeSort::getBytesWritten() const {
+    return bytesWritten;
+}
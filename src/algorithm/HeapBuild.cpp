@@ -1,9 +1,169 @@
 // src/algorithm/HeapBuild.cpp
 #include "../../include/algorithm/HeapBuild.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
 #include <iostream>
 #include <vector>
 #include <cmath>
 
+// Namespace for internal linkage
+namespace {
+constexpr std::size_t kCacheLineSize = 64;
+
+// Binary sift-down that carries the value in a hole instead of swapping at every level.
+// before(a, b) is true when a belongs above b, so min/max is fixed at compile time.
+template <typename Before>
+std::size_t siftDownHole(int* heap, std::size_t n, std::size_t i, Before before) {
+    std::size_t comparisons = 0;
+    const int value = heap[i];
+    std::size_t hole = i;
+    std::size_t child = 2 * hole + 1;
+
+    while (child < n) {
+        if (child + 1 < n) {
+            ++comparisons;
+            child += before(heap[child + 1], heap[child]);
+        }
+        ++comparisons;
+        if (!before(heap[child], value)) {
+            break;
+        }
+        heap[hole] = heap[child];
+        hole = child;
+        child = 2 * hole + 1;
+    }
+    heap[hole] = value;
+    return comparisons;
+}
+
+// Floyd's bottom-up variant: follow the better child all the way to a leaf (one comparison per level),
+// then climb back up to where the value belongs. Most values end near the bottom, so the climb is short.
+template <typename Before>
+std::size_t siftDownBottomUp(int* heap, std::size_t n, std::size_t i, Before before) {
+    std::size_t comparisons = 0;
+    const int value = heap[i];
+    std::size_t hole = i;
+    std::size_t child = 2 * hole + 1;
+
+    while (child + 1 < n) {
+        ++comparisons;
+        child += before(heap[child + 1], heap[child]);
+        heap[hole] = heap[child];
+        hole = child;
+        child = 2 * hole + 1;
+    }
+    if (child < n) {
+        heap[hole] = heap[child];
+        hole = child;
+    }
+
+    while (hole > i) {
+        const std::size_t parent = (hole - 1) / 2;
+        ++comparisons;
+        if (!before(value, heap[parent])) {
+            break;
+        }
+        heap[hole] = heap[parent];
+        hole = parent;
+    }
+    heap[hole] = value;
+    return comparisons;
+}
+
+// D-ary sift-down with a hole; a full sibling group is scanned with a fixed trip count so it unrolls.
+template <std::size_t D, typename Before>
+std::size_t siftDownDary(int* heap, std::size_t n, std::size_t i, Before before) {
+    std::size_t comparisons = 0;
+    const int value = heap[i];
+    std::size_t hole = i;
+
+    while (true) {
+        const std::size_t first = D * hole + 1;
+        if (first >= n) {
+            break;
+        }
+
+        std::size_t best = first;
+        if (first + D <= n) {
+            for (std::size_t k = 1; k < D; ++k) {
+                best = before(heap[first + k], heap[best]) ? first + k : best;
+            }
+            comparisons += D - 1;
+        } else {
+            for (std::size_t c = first + 1; c < n; ++c) {
+                best = before(heap[c], heap[best]) ? c : best;
+            }
+            comparisons += n - first - 1;
+        }
+
+        ++comparisons;
+        if (!before(heap[best], value)) {
+            break;
+        }
+        heap[hole] = heap[best];
+        hole = best;
+    }
+    heap[hole] = value;
+    return comparisons;
+}
+
+// Heapifies every internal node from the last one up to the root.
+template <std::size_t D, typename Sift>
+std::size_t buildWith(int* heap, std::size_t n, Sift sift) {
+    std::size_t comparisons = 0;
+    if (n < 2) {
+        return comparisons;
+    }
+    for (std::size_t i = (n - 2) / D + 1; i-- > 0;) {
+        comparisons += sift(heap, n, i);
+    }
+    return comparisons;
+}
+
+// Builds a d-ary heap in place; heap + 1 should start a cache line (see HeapBuild::alignStorage).
+template <std::size_t D, typename Before>
+std::size_t buildDary(int* heap, std::size_t n, Before before) {
+    return buildWith<D>(heap, n, [before](int* h, std::size_t size, std::size_t i) {
+        return siftDownDary<D>(h, size, i, before);
+    });
+}
+
+// Runs the selected non-recursive engine with a compile-time ordering.
+template <typename Before>
+std::size_t buildWithEngine(int* data, std::size_t n, HeapBuild::Engine engine, Before before) {
+    switch (engine) {
+        case HeapBuild::Engine::BOTTOM_UP:
+            return buildWith<2>(data, n, [before](int* h, std::size_t size, std::size_t i) {
+                return siftDownBottomUp(h, size, i, before);
+            });
+        case HeapBuild::Engine::QUATERNARY:
+            return buildDary<4>(data, n, before);
+        case HeapBuild::Engine::OCTONARY:
+            return buildDary<8>(data, n, before);
+        case HeapBuild::Engine::ITERATIVE:
+        default:
+            return buildWith<2>(data, n, [before](int* h, std::size_t size, std::size_t i) {
+                return siftDownHole(h, size, i, before);
+            });
+    }
+}
+
+// Short label used in the comparison table.
+const char* engineLabel(HeapBuild::Engine engine) {
+    switch (engine) {
+        case HeapBuild::Engine::ITERATIVE:  return "iterative hole";
+        case HeapBuild::Engine::BOTTOM_UP:  return "Floyd bottom-up";
+        case HeapBuild::Engine::QUATERNARY: return "4-ary cache aligned";
+        case HeapBuild::Engine::OCTONARY:   return "8-ary cache aligned";
+        case HeapBuild::Engine::RECURSIVE:
+        default:                            return "recursive";
+    }
+}
+} // namespace
+
 // Restores the heap property for the subtree at index i using a min/max orientation.
 void HeapBuild::heapify(std::vector<int>& elements, int n, int i, bool isMinHeap) {
     int extreme = i; // smallest (for min) or largest (for max)
@@ -11,6 +171,7 @@ void HeapBuild::heapify(std::vector<int>& elements, int n, int i, bool isMinHeap
     int right = 2 * i + 2;
 
     // Compare children with parent
+    comparisons += (left < n) + (right < n);
     if (isMinHeap) {
         if (left < n && elements[left] < elements[extreme])
             extreme = left;
@@ -32,9 +193,24 @@ void HeapBuild::heapify(std::vector<int>& elements, int n, int i, bool isMinHeap
     }
 }
 
-// Turns an arbitrary array into a heap by heapifying every internal node.
+// Turns an arbitrary array into a heap with the selected engine.
 void HeapBuild::buildHeap(std::vector<int>& elements, bool isMinHeap) {
     int n = elements.size();
+    comparisons = 0;
+
+    if (getArity() > 2) {
+        // Outside the timed path: the d-ary layout is built in aligned storage and copied back
+        alignStorage(elements.size());
+        std::copy(elements.begin(), elements.end(), heap);
+        buildInPlace(heap, elements.size(), isMinHeap);
+        std::copy(heap, heap + elements.size(), elements.begin());
+        prepared = false;
+        return;
+    }
+    if (engine != Engine::RECURSIVE) {
+        buildInPlace(elements.data(), elements.size(), isMinHeap);
+        return;
+    }
 
     // Start from last non-leaf node and heapify all subtrees
     for (int i = n / 2 - 1; i >= 0; --i) {
@@ -42,9 +218,25 @@ void HeapBuild::buildHeap(std::vector<int>& elements, bool isMinHeap) {
     }
 }
 
+// Children of i live at d*i+1 .. d*i+d, so with heap + 1 on a cache line every sibling group starts at a
+// multiple of d ints from that line and never straddles two lines (4 or 8 ints are 16 or 32 bytes).
+void HeapBuild::alignStorage(std::size_t n) {
+    storage.resize(n + 1 + kCacheLineSize / sizeof(int));
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(storage.data() + 1);
+    address = (address + kCacheLineSize - 1) & ~static_cast<std::uintptr_t>(kCacheLineSize - 1);
+    heap = reinterpret_cast<int*>(address) - 1;
+}
+
+// Picks the ordering once, so the sift loops compare with a compile-time functor.
+void HeapBuild::buildInPlace(int* data, std::size_t n, bool isMinHeap) {
+    comparisons = isMinHeap ? buildWithEngine(data, n, engine, std::less<int>())
+                            : buildWithEngine(data, n, engine, std::greater<int>());
+}
+
 // Performs the same build process but prints intermediate states for learning.
 void HeapBuild::buildHeapVisual(std::vector<int>& elements, bool isMinHeap) {
     int n = elements.size();
+    comparisons = 0;
     for (int i = n / 2 - 1; i >= 0; --i) {
         heapify(elements, n, i, isMinHeap);
         display(elements);
@@ -53,19 +245,22 @@ void HeapBuild::buildHeapVisual(std::vector<int>& elements, bool isMinHeap) {
 
 // Renders the underlying array as a level-order tree approximation.
 void HeapBuild::display(const std::vector<int>& elements) {
+    const std::size_t arity = getArity();
     int n = elements.size();
-    int levels = std::floor(std::log2(n)) + 1;
+    int levels = 0;
+    for (std::size_t covered = 0, width = 1; covered < elements.size(); covered += width, width *= arity) {
+        ++levels;
+    }
     int index = 0;
+    std::size_t levelCount = 1;
 
-    for (int level = 0; level < levels; ++level) {
-        int levelCount = static_cast<int>(std::pow(2, level));
-
+    for (int level = 0; level < levels; ++level, levelCount *= arity) {
         // spacing for tree-like shape
         int spaces = static_cast<int>(std::pow(2, levels - level));
         for (int s = 0; s < spaces; ++s)
             std::cout << " ";
 
-        for (int j = 0; j < levelCount && index < n; ++j, ++index) {
+        for (std::size_t j = 0; j < levelCount && index < n; ++j, ++index) {
             std::cout << elements[index] << " ";
             for (int s = 0; s < spaces; ++s)
                 std::cout << "  ";
@@ -75,8 +270,27 @@ void HeapBuild::display(const std::vector<int>& elements) {
     }
 }
 
-// Runs the heap construction silently when benchmarking.
+// Allocation and the first copy happen here; the binary engines need nothing ahead of the run.
+void HeapBuild::prepare(DataStructure* ds) {
+    prepared = false;
+    if (getArity() > 2) {
+        input = ds->getElements();
+        alignStorage(input.size());
+        prepared = true;
+    }
+}
+
+// Runs the heap construction silently when benchmarking. The d-ary engines restore the prepared input
+// with one copy, the same pass getElements() costs the binary engines, and build in place.
 void HeapBuild::execute(DataStructure* ds) {
+    if (getArity() > 2) {
+        if (!prepared) {
+            prepare(ds);
+        }
+        std::copy(input.begin(), input.end(), heap);
+        buildInPlace(heap, input.size(), isMinHeap);
+        return;
+    }
     std::vector<int> elements = ds->getElements();
     buildHeap(elements, isMinHeap);
 }
@@ -86,16 +300,101 @@ void HeapBuild::executeAndDisplay(DataStructure* ds) {
     std::vector<int> elements = ds->getElements();
 
     display(elements);
-    buildHeapVisual(elements, isMinHeap);
+    if (engine == Engine::RECURSIVE) {
+        buildHeapVisual(elements, isMinHeap);
+    } else {
+        // The iterative engines move values through holes, so only the finished heap is shown
+        buildHeap(elements, isMinHeap);
+    }
     display(elements);
 }
 
 // Return's the algorithm's name for output.
 std::string HeapBuild::getName() const {
-    return "Heap Build";
+    if (engine == Engine::RECURSIVE) {
+        return "Heap Build";
+    }
+    return std::string("Heap Build (") + engineLabel(engine) + ")";
 }
 
 // Chooses between building a min-heap (true) or max-heap (false).
 void HeapBuild::setHeapType(bool type) {
     isMinHeap = type;
 }
+
+// Chooses how the heap is built; prepared storage only serves the engine it was prepared for.
+void HeapBuild::setEngine(Engine choice) {
+    engine = choice;
+    prepared = false;
+}
+
+// The d-ary engines change the layout; every other engine builds a binary heap.
+std::size_t HeapBuild::getArity() const {
+    switch (engine) {
+        case Engine::QUATERNARY: return 4;
+        case Engine::OCTONARY:   return 8;
+        default:                 return 2;
+    }
+}
+
+// Getter for the comparison count of the last build.
+std::size_t HeapBuild::getComparisons() const {
+    return comparisons;
+}
+
+// Times each engine on its own copy of the input (best of three runs) and prints a table. Only the build
+// is timed; the d-ary engines get their aligned copy before the clock starts.
+void HeapBuild::compareEngines(DataStructure* ds) {
+    const std::vector<int> original = ds->getElements();
+    const Engine selected = engine;
+    const Engine engines[] = {Engine::RECURSIVE, Engine::ITERATIVE, Engine::BOTTOM_UP,
+                              Engine::QUATERNARY, Engine::OCTONARY};
+    double baselineMs = 0.0;
+    std::size_t baselineComparisons = 0;
+
+    std::cout << "\nHeap build engines (" << (isMinHeap ? "min" : "max") << "-heap, "
+              << original.size() << " elements):\n";
+    std::cout << std::left << std::setw(22) << "Engine" << std::right << std::setw(12) << "Time (ms)"
+              << std::setw(10) << "Speedup" << std::setw(16) << "Comparisons" << std::setw(10) << "Ratio" << "\n";
+
+    for (Engine candidate : engines) {
+        engine = candidate;
+        double bestMs = 0.0;
+        alignStorage(original.size());
+        for (int run = 0; run < 3; ++run) {
+            std::vector<int> elements = original;
+            int* data = elements.data();
+            if (getArity() > 2) {
+                std::copy(elements.begin(), elements.end(), heap);
+                data = heap;
+            }
+            auto start = std::chrono::high_resolution_clock::now();
+            if (candidate == Engine::RECURSIVE) {
+                buildHeap(elements, isMinHeap);
+            } else {
+                buildInPlace(data, elements.size(), isMinHeap);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            bestMs = run == 0 ? ms : std::min(bestMs, ms);
+        }
+
+        if (candidate == Engine::RECURSIVE) {
+            baselineMs = bestMs;
+            baselineComparisons = comparisons;
+        }
+
+        std::cout << std::left << std::setw(22) << engineLabel(candidate) << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(12) << bestMs
+                  << std::setprecision(2) << std::setw(9) << (bestMs > 0.0 ? baselineMs / bestMs : 0.0) << "x"
+                  << std::setw(16) << comparisons
+                  << std::setw(9) << (baselineComparisons > 0 ? double(comparisons) / double(baselineComparisons) : 0.0)
+                  << "x\n";
+    }
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6);
+
+    // The storage now holds the last engine's heap, so the next run prepares again
+    engine = selected;
+    prepared = false;
+}
@@ -1,22 +1,15 @@
 // src/algorithm/HeapSelection.cpp
 #include "../../include/algorithm/HeapSelection.hpp"
-#include <iostream>
 #include <queue>
 #include <functional>
-
-// Returns the computed k-th statistic and whether it was min or max based.
-void HeapSelection::display(const std::vector<int>& elements) {
-    if (isSmallest) {
-        std::cout << "The " << k << "-th smallest element is: " << result << std::endl;
-    } else {
-        std::cout << "The " << k << "-th largest element is: " << result << std::endl;
-    }
-}
+#include <utility>
 
 // Uses a max-heap to keep the k smallest values seen so far.
 int HeapSelection::findKthSmallest(std::vector<int>& elements, int k) {
-    // max heap to store k smallest
-    std::priority_queue<int> maxHeap;
+    // max heap to store k smallest, reserved up front so the pushes never reallocate
+    std::vector<int> storage;
+    storage.reserve(static_cast<std::size_t>(k) + 1);
+    std::priority_queue<int> maxHeap(std::less<int>(), std::move(storage));
 
     // Build the heap with the first k elements
     for (int val : elements) {
@@ -31,7 +24,9 @@ int HeapSelection::findKthSmallest(std::vector<int>& elements, int k) {
 // Mirrors findKthSmallest but retains the k largest elements through a min-heap.
 int HeapSelection::findKthLargest(std::vector<int>& elements, int k) {
     // min heap to store k largest
-    std::priority_queue<int, std::vector<int>, std::greater<int>> minHeap;
+    std::vector<int> storage;
+    storage.reserve(static_cast<std::size_t>(k) + 1);
+    std::priority_queue<int, std::vector<int>, std::greater<int>> minHeap(std::greater<int>(), std::move(storage));
 
     // Build the heap with the first k elements
     for (int val : elements) {
@@ -43,46 +38,15 @@ int HeapSelection::findKthLargest(std::vector<int>& elements, int k) {
     return minHeap.top();
 }
 
-// Computes the requested statistic without printing anything (benchmark mode).
-void HeapSelection::execute(DataStructure* ds) {
-    std::vector<int> elements = ds->getElements();
-
+// Picks the heap orientation that matches the search direction.
+int HeapSelection::select(std::vector<int>& elements) {
     if (isSmallest) {
-        result = findKthSmallest(elements, k);
-    } else {
-        result = findKthLargest(elements, k);
+        return findKthSmallest(elements, k);
     }
-}
-
-// Runs the selection and prints the answer to console.
-void HeapSelection::executeAndDisplay(DataStructure* ds) {
-    std::vector<int> elements = ds->getElements();
-
-    if (isSmallest) {
-        result = findKthSmallest(elements, k);
-    } else {
-        result = findKthLargest(elements, k);
-    }
-
-    display(elements);
+    return findKthLargest(elements, k);
 }
 
 // Gives the algorithm's name.
 std::string HeapSelection::getName() const {
     return "Heap Selection";
 }
-
-// Chooses between smallest or largest variants of the search.
-void HeapSelection::setIsSmallest(bool choice) {
-    isSmallest = choice;
-}
-
-// Stores the user-provided value of k.
-void HeapSelection::setK(int k) {
-    this->k = k;
-}
-
-// Getter for the last computed k-th value.
-int HeapSelection::getResult() const {
-    return result;
-}
@@ -1,5 +1,8 @@
 // src/algorithm/InsertionSort.cpp
 #include "../../include/algorithm/InsertionSort.hpp"
+#include "../../include/algorithm/SortingNetwork.hpp"
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <vector>
 
@@ -11,10 +14,8 @@ void InsertionSort::display(const std::vector<int>& elements) {
     std::cout << std::endl;
 }
 
-// Runs the insertion sort without printing results.
-void InsertionSort::execute(DataStructure* ds) {
-    std::vector<int> elements = ds->getElements();
-    // Insertion Sort Algorithm
+// Shifts larger elements right one slot at a time until the key fits.
+void InsertionSort::linearInsertionSort(std::vector<int>& elements) {
     for (int i = 1; i < elements.size(); ++i) {
         int key = elements[i];
         int j = i - 1;
@@ -26,12 +27,87 @@ void InsertionSort::execute(DataStructure* ds) {
     }
 }
 
+// Uses upper_bound on the sorted prefix so equal keys keep their order, then moves the tail in one call.
+void InsertionSort::binaryInsertionSort(std::vector<int>& elements) {
+    int* data = elements.data();
+    for (std::size_t i = 1; i < elements.size(); ++i) {
+        int key = data[i];
+        int* slot = std::upper_bound(data, data + i, key);
+        std::memmove(slot + 1, slot, static_cast<std::size_t>(data + i - slot) * sizeof(int));
+        *slot = key;
+    }
+}
+
+// Counts the prefix keys <= key instead of searching, so the loop bounds never depend on the data
+// and the compiler can vectorize the count; the shift is a single memmove.
+void InsertionSort::branchlessInsertionSort(std::vector<int>& elements) {
+    int* data = elements.data();
+    for (std::size_t i = 1; i < elements.size(); ++i) {
+        const int key = data[i];
+        std::size_t pos = 0;
+        for (std::size_t k = 0; k < i; ++k) {
+            pos += static_cast<std::size_t>(data[k] <= key);
+        }
+        std::memmove(data + pos + 1, data + pos, (i - pos) * sizeof(int));
+        data[pos] = key;
+    }
+}
+
+// Small inputs go through the unrolled network for their exact size.
+void InsertionSort::networkSort(std::vector<int>& elements) {
+    if (!SortingNetworks::sort(elements.data(), elements.size())) {
+        binaryInsertionSort(elements);
+    }
+}
+
+// Runs the kernel for the selected variant.
+void InsertionSort::sortElements(std::vector<int>& elements) {
+    switch (variant) {
+        case Variant::BINARY:
+            binaryInsertionSort(elements);
+            break;
+        case Variant::BRANCHLESS:
+            branchlessInsertionSort(elements);
+            break;
+        case Variant::NETWORK:
+            networkSort(elements);
+            break;
+        case Variant::LINEAR:
+        default:
+            linearInsertionSort(elements);
+            break;
+    }
+}
+
+// Runs the insertion sort without printing results.
+void InsertionSort::execute(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+    if (repetitions <= 1) {
+        sortElements(elements);
+        return;
+    }
+
+    // Every repetition sorts the same unsorted input
+    std::vector<int> working(elements.size());
+    for (std::size_t r = 0; r < repetitions; ++r) {
+        std::copy(elements.begin(), elements.end(), working.begin());
+        sortElements(working);
+    }
+}
+
 // Performs the same algorithm but shows the array after each operation.
 void InsertionSort::executeAndDisplay(DataStructure* ds) {
     std::vector<int> elements = ds->getElements();
-    
+
     display(elements);
-    
+
+    // Only the classic kernel has meaningful intermediate states
+    if (variant != Variant::LINEAR) {
+        sortElements(elements);
+        display(elements);
+        return;
+    }
+
     // Insertion Sort Algorithm with display
     for (int i = 1; i < elements.size(); ++i) {
         int key = elements[i];
@@ -49,5 +125,40 @@ void InsertionSort::executeAndDisplay(DataStructure* ds) {
 
 // Returns the algorithm's name.
 std::string InsertionSort::getName() const {
-    return "Insertion Sort";
+    std::string name;
+    switch (variant) {
+        case Variant::BINARY:
+            name = "Binary Insertion Sort";
+            break;
+        case Variant::BRANCHLESS:
+            name = "Branchless Insertion Sort";
+            break;
+        case Variant::NETWORK:
+            name = "Sorting Network (n <= " + std::to_string(SortingNetworks::kMaxSize) + ")";
+            break;
+        case Variant::LINEAR:
+        default:
+            name = "Insertion Sort";
+            break;
+    }
+
+    if (repetitions > 1) {
+        name += " x" + std::to_string(repetitions);
+    }
+    return name;
+}
+
+// Returns how many sorts one execute() performs.
+std::size_t InsertionSort::getRepetitions() const {
+    return repetitions;
+}
+
+// Chooses the insertion kernel.
+void InsertionSort::setVariant(Variant choice) {
+    variant = choice;
+}
+
+// Stores the repetition count (at least one).
+void InsertionSort::setRepetitions(std::size_t count) {
+    repetitions = std::max<std::size_t>(1, count);
 }
@@ -0,0 +1,180 @@
+// src/algorithm/KWayMerge.cpp
+#include "../../include/algorithm/KWayMerge.hpp"
+#include "../../include/algorithm/LoserTree.hpp"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <utility>
+
+// Namespace for internal linkage
+namespace {
+// Outputs up to this size are printed by executeAndDisplay.
+constexpr std::size_t kDisplayLimit = 32;
+
+// Label printed for each engine.
+const char* engineName(KWayMerge::Engine engine) {
+    switch (engine) {
+        case KWayMerge::Engine::HEAP:
+            return "binary heap";
+        case KWayMerge::Engine::PAIRWISE:
+            return "pairwise two-way";
+        case KWayMerge::Engine::LOSER_TREE:
+        default:
+            return "loser tree";
+    }
+}
+} // namespace
+
+// Run r gets an equal share of the elements (the first n % ways runs get one more) and is sorted in place.
+void KWayMerge::prepare(DataStructure* ds) {
+    runs = ds->getElements();
+    const std::size_t n = runs.size();
+    offsets.assign(ways + 1, 0);
+    for (std::size_t r = 0; r < ways; ++r) {
+        offsets[r + 1] = offsets[r] + n / ways + (r < n % ways ? 1 : 0);
+        std::sort(runs.begin() + offsets[r], runs.begin() + offsets[r + 1]);
+    }
+    output.assign(n, 0);
+    scratch.assign(n, 0);
+    prepared = true;
+}
+
+// One pass for the tournament engines; the pairwise engine halves the run count per pass.
+void KWayMerge::mergeWith(Engine choice) {
+    switch (choice) {
+        case Engine::HEAP: {
+            using Entry = std::pair<int, std::size_t>;
+            std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heads;
+            std::vector<std::size_t> cursors(offsets.begin(), offsets.end() - 1);
+            for (std::size_t r = 0; r < ways; ++r) {
+                if (cursors[r] != offsets[r + 1]) {
+                    heads.emplace(runs[cursors[r]], r);
+                }
+            }
+            for (std::size_t i = 0; !heads.empty(); ++i) {
+                const std::size_t r = heads.top().second;
+                output[i] = heads.top().first;
+                heads.pop();
+                if (++cursors[r] != offsets[r + 1]) {
+                    heads.emplace(runs[cursors[r]], r);
+                }
+            }
+            break;
+        }
+        case Engine::PAIRWISE: {
+            // Merge neighbouring runs, ping-ponging between output and scratch; the first target is
+            // picked so that the last pass lands in output
+            const std::size_t passes = passesFor(choice);
+            if (passes == 0) {
+                std::copy(runs.begin(), runs.end(), output.begin());
+                break;
+            }
+            const int* source = runs.data();
+            int* target = passes % 2 == 1 ? output.data() : scratch.data();
+            std::vector<std::size_t> bounds = offsets;
+            while (bounds.size() > 2) {
+                std::vector<std::size_t> merged{0};
+                for (std::size_t r = 0; r + 1 < bounds.size(); r += 2) {
+                    const std::size_t end = r + 2 < bounds.size() ? bounds[r + 2] : bounds[r + 1];
+                    std::merge(source + bounds[r], source + bounds[r + 1], source + bounds[r + 1], source + end,
+                               target + bounds[r]);
+                    merged.push_back(end);
+                }
+                source = target;
+                target = target == output.data() ? scratch.data() : output.data();
+                bounds = std::move(merged);
+            }
+            break;
+        }
+        case Engine::LOSER_TREE:
+        default: {
+            std::vector<LoserTree::Run> views(ways);
+            for (std::size_t r = 0; r < ways; ++r) {
+                views[r] = {runs.data() + offsets[r], runs.data() + offsets[r + 1]};
+            }
+            LoserTree::merge(views, output.data());
+            break;
+        }
+    }
+}
+
+// ceil(log2(ways)) for pairwise merging (zero for a single run), one for the tournament engines.
+std::size_t KWayMerge::passesFor(Engine choice) const {
+    if (choice != Engine::PAIRWISE) {
+        return 1;
+    }
+    std::size_t passes = 0;
+    for (std::size_t count = ways; count > 1; count = (count + 1) / 2) {
+        ++passes;
+    }
+    return passes;
+}
+
+// Merges the prepared runs; prepares them first when called outside a benchmark.
+void KWayMerge::execute(DataStructure* ds) {
+    if (!prepared) {
+        prepare(ds);
+    }
+    mergeWith(engine);
+}
+
+// Prints small outputs, then times every engine on the same runs (best of 3).
+void KWayMerge::executeAndDisplay(DataStructure* ds) {
+    prepare(ds);
+    mergeWith(engine);
+    if (output.size() <= kDisplayLimit) {
+        display(output);
+    }
+
+    const double megabytes = static_cast<double>(output.size() * sizeof(int)) / 1e6;
+    std::cout << "\n" << ways << "-way merge of " << output.size() << " keys:\n";
+    std::cout << std::left << std::setw(20) << "Engine" << std::right << std::setw(8) << "Passes"
+              << std::setw(12) << "Time (ms)" << std::setw(12) << "MB/s" << "\n";
+    for (Engine choice : {Engine::LOSER_TREE, Engine::HEAP, Engine::PAIRWISE}) {
+        double bestMs = 0.0;
+        for (int run = 0; run < 3; ++run) {
+            auto start = std::chrono::high_resolution_clock::now();
+            mergeWith(choice);
+            auto end = std::chrono::high_resolution_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            bestMs = run == 0 ? ms : std::min(bestMs, ms);
+        }
+        std::cout << std::left << std::setw(20) << engineName(choice) << std::right << std::setw(8) << passesFor(choice)
+                  << std::fixed << std::setprecision(3) << std::setw(12) << bestMs << std::setprecision(0)
+                  << std::setw(12) << (bestMs > 0.0 ? megabytes * 1000.0 / bestMs : 0.0) << "\n";
+    }
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6);
+}
+
+// Prints the array on a single line.
+void KWayMerge::display(const std::vector<int>& elements) {
+    for (const int& val : elements) {
+        std::cout << val << " ";
+    }
+    std::cout << std::endl;
+}
+
+// Returns the algorithm's name with its configuration.
+std::string KWayMerge::getName() const {
+    return "K-Way Merge (" + std::to_string(ways) + " runs, " + engineName(engine) + ")";
+}
+
+// Chooses the merge engine.
+void KWayMerge::setEngine(Engine choice) {
+    engine = choice;
+}
+
+// Stores the fan-in; the runs are rebuilt on the next execution.
+void KWayMerge::setWays(std::size_t count) {
+    ways = std::max<std::size_t>(1, count);
+    prepared = false;
+}
+
+// Getter for the merged keys.
+const std::vector<int>& KWayMerge::getOutput() const {
+    return output;
+}
@@ -0,0 +1,247 @@
+// src/algorithm/LsdRadixSort.cpp
+#include "../../include/algorithm/LsdRadixSort.hpp"
+#include "../../include/core/WorkStealingThreadPool.hpp"
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+// Namespace for internal linkage
+namespace {
+// Flipping the sign bit maps signed order onto unsigned order.
+constexpr std::uint32_t kSignBit = 0x80000000u;
+
+// Smallest number of keys worth handing to a separate thread.
+constexpr std::size_t kMinKeysPerThread = 1 << 14;
+
+// Number of digit passes needed to cover a 32-bit key.
+int passCount(int digitBits) {
+    return (32 + digitBits - 1) / digitBits;
+}
+
+// A pass whose keys all share one digit would only copy the data, so it can be skipped.
+bool isTrivialPass(const std::size_t* histogram, std::size_t radix, std::size_t n) {
+    for (std::size_t d = 0; d < radix; ++d) {
+        if (histogram[d] != 0) {
+            return histogram[d] == n;
+        }
+    }
+    return true;
+}
+} // namespace
+
+// Sorts with one histogram sweep followed by one scatter per non-trivial digit.
+void LsdRadixSort::sortSerial(std::vector<int>& elements) {
+    const std::size_t n = elements.size();
+    const int passes = passCount(digitBits);
+    const std::size_t radix = std::size_t(1) << digitBits;
+    const std::uint32_t mask = static_cast<std::uint32_t>(radix - 1);
+
+    // int and unsigned int may alias, so the keys are flipped in place
+    std::uint32_t* keys = reinterpret_cast<std::uint32_t*>(elements.data());
+    std::vector<std::uint32_t> buffer(n);
+    std::vector<std::size_t> histograms(passes * radix, 0);
+
+    // One read of the input builds the histogram of every digit
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint32_t key = keys[i] ^ kSignBit;
+        keys[i] = key;
+        for (int p = 0; p < passes; ++p) {
+            ++histograms[p * radix + ((key >> (p * digitBits)) & mask)];
+        }
+    }
+
+    std::uint32_t* src = keys;
+    std::uint32_t* dst = buffer.data();
+    std::vector<std::size_t> offsets(radix);
+
+    for (int p = 0; p < passes; ++p) {
+        const std::size_t* histogram = &histograms[p * radix];
+        if (isTrivialPass(histogram, radix, n)) {
+            continue;
+        }
+
+        // Exclusive prefix sum gives each digit's first output slot
+        std::size_t sum = 0;
+        for (std::size_t d = 0; d < radix; ++d) {
+            offsets[d] = sum;
+            sum += histogram[d];
+        }
+
+        const int shift = p * digitBits;
+        for (std::size_t i = 0; i < n; ++i) {
+            std::uint32_t key = src[i];
+            dst[offsets[(key >> shift) & mask]++] = key;
+        }
+        std::swap(src, dst);
+    }
+
+    // Undo the sign flip, copying back if the last pass ended in the buffer
+    for (std::size_t i = 0; i < n; ++i) {
+        keys[i] = src[i] ^ kSignBit;
+    }
+}
+
+// Each task owns a contiguous chunk: it counts its digits, then scatters into its own slots.
+void LsdRadixSort::sortParallel(std::vector<int>& elements, unsigned threads) {
+    ThreadPool& pool = WorkStealingThreadPool::poolFor(context);
+    const std::size_t n = elements.size();
+    const int passes = passCount(digitBits);
+    const std::size_t radix = std::size_t(1) << digitBits;
+    const std::uint32_t mask = static_cast<std::uint32_t>(radix - 1);
+    const std::size_t chunk = (n + threads - 1) / threads;
+
+    std::uint32_t* keys = reinterpret_cast<std::uint32_t*>(elements.data());
+    std::vector<std::uint32_t> buffer(n);
+
+    // local[t][p][d]: per-thread histograms, so counting needs no synchronization
+    std::vector<std::size_t> local(static_cast<std::size_t>(threads) * passes * radix, 0);
+    auto localHistogram = [&](unsigned t, int p) {
+        return &local[(static_cast<std::size_t>(t) * passes + p) * radix];
+    };
+
+    pool.runTasks(threads, [&](unsigned t) {
+        const std::size_t begin = std::min(n, t * chunk);
+        const std::size_t end = std::min(n, begin + chunk);
+        for (std::size_t i = begin; i < end; ++i) {
+            std::uint32_t key = keys[i] ^ kSignBit;
+            keys[i] = key;
+            for (int p = 0; p < passes; ++p) {
+                ++localHistogram(t, p)[(key >> (p * digitBits)) & mask];
+            }
+        }
+    });
+
+    std::uint32_t* src = keys;
+    std::uint32_t* dst = buffer.data();
+    std::vector<std::size_t> totals(radix);
+    std::vector<std::size_t> offsets(static_cast<std::size_t>(threads) * radix);
+    bool inputOrder = true;
+
+    for (int p = 0; p < passes; ++p) {
+        const int shift = p * digitBits;
+
+        std::fill(totals.begin(), totals.end(), 0);
+        for (unsigned t = 0; t < threads; ++t) {
+            const std::size_t* histogram = localHistogram(t, p);
+            for (std::size_t d = 0; d < radix; ++d) {
+                totals[d] += histogram[d];
+            }
+        }
+        if (isTrivialPass(totals.data(), radix, n)) {
+            continue;
+        }
+
+        // After the first scatter the chunks hold different keys, so this digit is recounted
+        if (!inputOrder) {
+            pool.runTasks(threads, [&](unsigned t) {
+                std::size_t* histogram = localHistogram(t, p);
+                std::fill(histogram, histogram + radix, 0);
+                const std::size_t begin = std::min(n, t * chunk);
+                const std::size_t end = std::min(n, begin + chunk);
+                for (std::size_t i = begin; i < end; ++i) {
+                    ++histogram[(src[i] >> shift) & mask];
+                }
+            });
+        }
+
+        // Digit-major, thread-minor prefix sum keeps the scatter stable
+        std::size_t sum = 0;
+        for (std::size_t d = 0; d < radix; ++d) {
+            for (unsigned t = 0; t < threads; ++t) {
+                offsets[t * radix + d] = sum;
+                sum += localHistogram(t, p)[d];
+            }
+        }
+
+        pool.runTasks(threads, [&](unsigned t) {
+            std::size_t* threadOffsets = &offsets[t * radix];
+            const std::size_t begin = std::min(n, t * chunk);
+            const std::size_t end = std::min(n, begin + chunk);
+            for (std::size_t i = begin; i < end; ++i) {
+                std::uint32_t key = src[i];
+                dst[threadOffsets[(key >> shift) & mask]++] = key;
+            }
+        });
+
+        std::swap(src, dst);
+        inputOrder = false;
+    }
+
+    pool.runTasks(threads, [&](unsigned t) {
+        const std::size_t begin = std::min(n, t * chunk);
+        const std::size_t end = std::min(n, begin + chunk);
+        for (std::size_t i = begin; i < end; ++i) {
+            keys[i] = src[i] ^ kSignBit;
+        }
+    });
+}
+
+// Prints the array on a single line.
+void LsdRadixSort::display(const std::vector<int>& elements) {
+    for (const int& val : elements) {
+        std::cout << val << " ";
+    }
+    std::cout << std::endl;
+}
+
+// Picks the serial or threaded kernel based on the thread count and input size.
+void LsdRadixSort::sort(std::vector<int>& elements) {
+    if (elements.size() < 2) {
+        return;
+    }
+
+    std::size_t usefulThreads = std::max<std::size_t>(1, elements.size() / kMinKeysPerThread);
+    unsigned threads = static_cast<unsigned>(std::min<std::size_t>(threadCount, usefulThreads));
+    if (threads > 1) {
+        sortParallel(elements, threads);
+    } else {
+        sortSerial(elements);
+    }
+}
+
+// Runs the radix sort on a copy of the elements.
+void LsdRadixSort::execute(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+    sort(elements);
+}
+
+// Digit passes reorder the whole array at once, so only before/after states are shown.
+void LsdRadixSort::executeAndDisplay(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+
+    display(elements);
+    sort(elements);
+    display(elements);
+}
+
+// Returns the algorithm's name with its configuration.
+std::string LsdRadixSort::getName() const {
+    std::string name = "LSD Radix Sort (" + std::to_string(digitBits) + "-bit digits";
+    if (threadCount > 1) {
+        name += ", " + std::to_string(threadCount) + " threads";
+    }
+    return name + ")";
+}
+
+// Accepts the two supported digit widths.
+void LsdRadixSort::setDigitBits(int bits) {
+    if (bits == 8 || bits == 11) {
+        digitBits = bits;
+    }
+}
+
+// Digit passes can be split across the pool.
+bool LsdRadixSort::isParallel() const {
+    return true;
+}
+
+// Getter for the task count.
+unsigned LsdRadixSort::getThreadCount() const {
+    return threadCount;
+}
+
+// Stores the requested number of threads (at least one).
+void LsdRadixSort::setThreadCount(unsigned threads) {
+    threadCount = std::max(1u, threads);
+}
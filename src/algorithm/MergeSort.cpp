@@ -1,8 +1,16 @@
 // src/algorithm/MergeSort.cpp
 #include "../../include/algorithm/MergeSort.hpp"
+#include "../../include/algorithm/LoserTree.hpp"
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
+// Namespace for internal linkage
+namespace {
+// Slices up to this size are finished with insertion sort by the multiway variant.
+constexpr std::size_t kMultiwayBaseSize = 32;
+} // namespace
+
 // Performs the recursive divide-and-conquer merge sort.
 void MergeSort::mergeSort(std::vector<int>& elements, int left, int right) {
     if (left >= right) {
@@ -85,6 +93,50 @@ void MergeSort::mergeVisual(std::vector<int>& elements, int left, int mid, int r
     }
 }
 
+// Each level splits the range into up to ways slices, sorts them into the other buffer and merges them
+// back with one loser-tree pass, so n keys take about log_ways(n / 32) passes instead of log2(n).
+// Alternating the target between data and buffer avoids copying the merged result back.
+void MergeSort::multiwaySort(int* data, int* buffer, std::size_t n, bool intoBuffer) {
+    int* target = intoBuffer ? buffer : data;
+    if (n <= kMultiwayBaseSize) {
+        if (intoBuffer) {
+            std::copy(data, data + n, buffer);
+        }
+        for (std::size_t i = 1; i < n; ++i) {
+            int key = target[i];
+            std::size_t j = i;
+            while (j > 0 && target[j - 1] > key) {
+                target[j] = target[j - 1];
+                --j;
+            }
+            target[j] = key;
+        }
+        return;
+    }
+
+    const std::size_t slices = std::min(ways, (n + kMultiwayBaseSize - 1) / kMultiwayBaseSize);
+    const int* source = intoBuffer ? data : buffer;
+    std::vector<LoserTree::Run> runs(slices);
+    std::size_t begin = 0;
+    for (std::size_t s = 0; s < slices; ++s) {
+        const std::size_t length = n / slices + (s < n % slices ? 1 : 0);
+        multiwaySort(data + begin, buffer + begin, length, !intoBuffer);
+        runs[s] = {source + begin, source + begin + length};
+        begin += length;
+    }
+    LoserTree::merge(runs, target);
+}
+
+// Runs the kernel for the selected variant.
+void MergeSort::sortElements(std::vector<int>& elements) {
+    if (variant == Variant::MULTIWAY) {
+        std::vector<int> buffer(elements.size());
+        multiwaySort(elements.data(), buffer.data(), elements.size(), false);
+        return;
+    }
+    mergeSort(elements, 0, static_cast<int>(elements.size()) - 1);
+}
+
 // Prints the array in order, useful for before/after comparisons.
 void MergeSort::display(const std::vector<int>& elements) {
     for (const int& val : elements) {
@@ -96,7 +148,7 @@ void MergeSort::display(const std::vector<int>& elements) {
 // Entry point for benchmarking that runs the non-visual merge sort.
 void MergeSort::execute(DataStructure* ds) {
     std::vector<int> elements = ds->getElements();
-    mergeSort(elements, 0, elements.size()- 1);
+    sortElements(elements);
 }
 
 // Executes the visual variant to show intermediate merging steps.
@@ -104,11 +156,32 @@ void MergeSort::executeAndDisplay(DataStructure* ds) {
     std::vector<int> elements = ds->getElements();
 
     display(elements);
+
+    // Multiway merges write whole levels at once, so only the final state is shown
+    if (variant == Variant::MULTIWAY) {
+        sortElements(elements);
+        display(elements);
+        return;
+    }
+
     mergeSortVisual(elements, 0, static_cast<int>(elements.size()) - 1);
     display(elements);
 }
 
 // Returns the algorithm's name.
 std::string MergeSort::getName() const {
+    if (variant == Variant::MULTIWAY) {
+        return "Multiway Merge Sort (" + std::to_string(ways) + "-way loser tree)";
+    }
     return "Merge Sort";
 }
+
+// Chooses the merge strategy.
+void MergeSort::setVariant(Variant choice) {
+    variant = choice;
+}
+
+// Stores the multiway fan-in (at least two).
+void MergeSort::setWays(std::size_t count) {
+    ways = std::max<std::size_t>(2, count);
+}
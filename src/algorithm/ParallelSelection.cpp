@@ -0,0 +1,221 @@
+// src/algorithm/ParallelSelection.cpp
+#include "../../include/algorithm/ParallelSelection.hpp"
+#include "../../include/algorithm/QuickSelect.hpp"
+#include "../../include/algorithm/SimdKernels.hpp"
+#include "../../include/algorithm/SplitMix64.hpp"
+#include "../../include/algorithm/TopKBuffer.hpp"
+#include "../../include/core/WorkStealingThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// Namespace for internal linkage
+namespace {
+// Local heaps pay off while every thread's slice is at least this many times k.
+constexpr std::size_t kHeapSliceRatio = 256;
+// Elements drawn for the pivot sample.
+constexpr std::size_t kSampleSize = std::size_t(1) << 16;
+// Smallest slice worth handing to a separate thread.
+constexpr std::size_t kMinElementsPerThread = std::size_t(1) << 14;
+
+// Caps the thread count so no thread gets a trivially small slice.
+unsigned usefulThreads(unsigned requested, std::size_t n) {
+    std::size_t useful = std::max<std::size_t>(1, n / kMinElementsPerThread);
+    return static_cast<unsigned>(std::min<std::size_t>(requested, useful));
+}
+
+// Label printed for each strategy.
+const char* strategyName(ParallelSelection::Strategy strategy) {
+    switch (strategy) {
+        case ParallelSelection::Strategy::LOCAL_HEAPS:
+            return "local top-k heaps";
+        case ParallelSelection::Strategy::SAMPLE_PIVOTS:
+            return "sample pivots";
+        case ParallelSelection::Strategy::AUTO:
+        default:
+            return "auto";
+    }
+}
+} // namespace
+
+// Starts with the widest instruction set available on this machine.
+ParallelSelection::ParallelSelection() : level(SimdKernels::detectLevel()) {}
+
+// Local heaps only win while k is small next to each thread's slice.
+ParallelSelection::Strategy ParallelSelection::resolveStrategy(std::size_t n) const {
+    if (strategy != Strategy::AUTO) {
+        return strategy;
+    }
+    const std::size_t slice = n / std::max(1u, threadCount);
+    return static_cast<std::size_t>(k) * kHeapSliceRatio <= slice ? Strategy::LOCAL_HEAPS : Strategy::SAMPLE_PIVOTS;
+}
+
+// Each task filters its contiguous slice into its own TopKBuffer; task 0 merges the others.
+int ParallelSelection::selectLocalHeaps(const std::vector<int>& elements, unsigned threads) {
+    const std::size_t n = elements.size();
+    const std::size_t chunk = (n + threads - 1) / threads;
+    std::vector<std::unique_ptr<TopKBuffer>> buffers(threads);
+
+    WorkStealingThreadPool::poolFor(context).runTasks(threads, [&](unsigned t) {
+        const std::size_t begin = std::min(n, t * chunk);
+        const std::size_t end = std::min(n, begin + chunk);
+        buffers[t] = std::make_unique<TopKBuffer>(static_cast<std::size_t>(k), !isSmallest, level);
+        buffers[t]->offer(elements.data() + begin, end - begin);
+    });
+
+    for (unsigned t = 1; t < threads; ++t) {
+        buffers[0]->merge(*buffers[t]);
+    }
+    return buffers[0]->threshold();
+}
+
+// Sample-select: two pivots taken a few standard deviations either side of the target rank in a sorted
+// sample leave about n * 4 / sqrt(sample) elements between them. Threads count the keys below the band and
+// copy the band out in one pass; the answer is then a small serial selection inside the band. If the
+// sample was unlucky and the rank falls outside the band, the whole input is selected serially.
+int ParallelSelection::selectSamplePivots(std::vector<int>& elements, unsigned threads) {
+    const std::size_t n = elements.size();
+    const std::size_t index = isSmallest ? static_cast<std::size_t>(k - 1) : n - static_cast<std::size_t>(k);
+
+    if (n <= kSampleSize * 4) {
+        return QuickSelect::introselect(elements.data(), n, index);
+    }
+
+    std::vector<int> sample(kSampleSize);
+    std::uint64_t state = 0x5EEDull ^ n;
+    for (int& value : sample) {
+        value = elements[splitMix64(state) % n];
+    }
+    std::sort(sample.begin(), sample.end());
+
+    const double position = static_cast<double>(index) * kSampleSize / static_cast<double>(n);
+    const double spread = 2.0 * std::sqrt(static_cast<double>(kSampleSize));
+    const std::size_t lowSlot = static_cast<std::size_t>(std::max(0.0, position - spread));
+    const std::size_t highSlot = static_cast<std::size_t>(std::min(kSampleSize - 1.0, position + spread));
+    const int low = sample[lowSlot];
+    const int high = sample[highSlot];
+
+    const std::size_t chunk = (n + threads - 1) / threads;
+    std::vector<std::size_t> below(threads, 0);
+    std::vector<std::vector<int>> bands(threads);
+
+    WorkStealingThreadPool::poolFor(context).runTasks(threads, [&](unsigned t) {
+        const std::size_t begin = std::min(n, t * chunk);
+        const std::size_t end = std::min(n, begin + chunk);
+        std::size_t count = 0;
+        std::vector<int>& band = bands[t];
+        band.reserve((end - begin) / 16);
+        for (std::size_t i = begin; i < end; ++i) {
+            const int value = elements[i];
+            count += value < low;
+            if (value >= low && value <= high) {
+                band.push_back(value);
+            }
+        }
+        below[t] = count;
+    });
+
+    std::size_t belowTotal = 0;
+    std::size_t bandTotal = 0;
+    for (unsigned t = 0; t < threads; ++t) {
+        belowTotal += below[t];
+        bandTotal += bands[t].size();
+    }
+
+    if (index < belowTotal || index >= belowTotal + bandTotal) {
+        return QuickSelect::introselect(elements.data(), n, index);
+    }
+
+    std::vector<int> band;
+    band.reserve(bandTotal);
+    for (const auto& part : bands) {
+        band.insert(band.end(), part.begin(), part.end());
+    }
+    return QuickSelect::introselect(band.data(), band.size(), index - belowTotal);
+}
+
+// Dispatches to the resolved strategy.
+int ParallelSelection::selectWithThreads(std::vector<int>& elements, unsigned threads) {
+    threads = usefulThreads(threads, elements.size());
+    if (resolveStrategy(elements.size()) == Strategy::LOCAL_HEAPS) {
+        return selectLocalHeaps(elements, threads);
+    }
+    return selectSamplePivots(elements, threads);
+}
+
+// Runs on the configured number of threads.
+int ParallelSelection::select(std::vector<int>& elements) {
+    return selectWithThreads(elements, threadCount);
+}
+
+// Each row is the best of three runs on a fresh copy; efficiency is speedup divided by threads.
+void ParallelSelection::printScaling(const std::vector<int>& elements) {
+    std::cout << "\nScaling (" << strategyName(resolveStrategy(elements.size())) << ", "
+              << elements.size() << " elements, pool threads: " << WorkStealingThreadPool::poolFor(context).threadCount() << "):\n";
+    std::cout << std::setw(8) << "Threads" << std::setw(12) << "Time (ms)" << std::setw(10) << "Speedup"
+              << std::setw(12) << "Efficiency" << "\n";
+
+    double baselineMs = 0.0;
+    for (unsigned threads = 1;; threads = std::min(threads * 2, threadCount)) {
+        double bestMs = 0.0;
+        for (int run = 0; run < 3; ++run) {
+            std::vector<int> copy = elements;
+            auto start = std::chrono::high_resolution_clock::now();
+            selectWithThreads(copy, threads);
+            auto end = std::chrono::high_resolution_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            bestMs = run == 0 ? ms : std::min(bestMs, ms);
+        }
+        if (threads == 1) {
+            baselineMs = bestMs;
+        }
+
+        const double speedup = bestMs > 0.0 ? baselineMs / bestMs : 0.0;
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(3) << std::setw(12) << bestMs
+                  << std::setprecision(2) << std::setw(9) << speedup << "x"
+                  << std::setw(11) << speedup / threads * 100.0 << "%\n";
+
+        if (threads == threadCount) {
+            break;
+        }
+    }
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6);
+}
+
+// Prints the result, then how the selection scales with threads.
+void ParallelSelection::executeAndDisplay(DataStructure* ds) {
+    SelectionAlgorithm::executeAndDisplay(ds);
+    printScaling(ds->getElements());
+}
+
+// Returns the algorithm's name with its configuration.
+std::string ParallelSelection::getName() const {
+    return std::string("Parallel Selection (") + strategyName(strategy) + ", " +
+           std::to_string(threadCount) + (threadCount == 1 ? " thread)" : " threads)");
+}
+
+// The input is always split across the pool.
+bool ParallelSelection::isParallel() const {
+    return true;
+}
+
+// Getter for the task count.
+unsigned ParallelSelection::getThreadCount() const {
+    return threadCount;
+}
+
+// Chooses how the work is split.
+void ParallelSelection::setStrategy(Strategy choice) {
+    strategy = choice;
+}
+
+// Stores the requested number of threads (at least one).
+void ParallelSelection::setThreadCount(unsigned threads) {
+    threadCount = std::max(1u, threads);
+}
@@ -0,0 +1,381 @@
+// src/algorithm/PdqSort.cpp
+//
+// The partitioning kernel below is adapted from pdqsort by Orson Peters
+// (https://github.com/orlp/pdqsort), distributed under the following license:
+//
+//     Copyright (c) 2021 Orson Peters
+//
+//     This software is provided 'as-is', without any express or implied warranty. In no event will the
+//     authors be held liable for any damages arising from the use of this software.
+//
+//     Permission is granted to anyone to use this software for any purpose, including commercial
+//     applications, and to alter it and redistribute it freely, subject to the following restrictions:
+//
+//     1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+//        original software. If you use this software in a product, an acknowledgment in the product
+//        documentation would be appreciated but is not required.
+//
+//     2. Altered source versions must be plainly marked as such, and must not be misrepresented as
+//        being the original software.
+//
+//     3. This notice may not be removed or altered from any source distribution.
+//
+// Altered from the original: specialised to int, renamed to this repository's conventions and wrapped
+// in the Algorithm interface.
+#include "../../include/algorithm/PdqSort.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+// Namespace for internal linkage
+namespace {
+// Partitions below this size are finished with insertion sort.
+constexpr std::ptrdiff_t kInsertionSortThreshold = 24;
+// Partitions above this size use Tukey's ninther for the pivot.
+constexpr std::ptrdiff_t kNintherThreshold = 128;
+// Element moves allowed before partial insertion sort gives up.
+constexpr std::size_t kPartialInsertionSortLimit = 8;
+// Elements classified per block by the branchless partition.
+constexpr std::size_t kBlockSize = 64;
+constexpr std::size_t kCacheLineSize = 64;
+
+// Plain insertion sort used on the leftmost partition.
+void insertionSort(int* begin, int* end) {
+    if (begin == end) return;
+
+    for (int* cur = begin + 1; cur != end; ++cur) {
+        int* sift = cur;
+        int* siftPrev = cur - 1;
+        if (*sift < *siftPrev) {
+            int tmp = *sift;
+            do {
+                *sift-- = *siftPrev;
+            } while (sift != begin && tmp < *--siftPrev);
+            *sift = tmp;
+        }
+    }
+}
+
+// Insertion sort that relies on *(begin - 1) being <= every element as a sentinel.
+void unguardedInsertionSort(int* begin, int* end) {
+    if (begin == end) return;
+
+    for (int* cur = begin + 1; cur != end; ++cur) {
+        int* sift = cur;
+        int* siftPrev = cur - 1;
+        if (*sift < *siftPrev) {
+            int tmp = *sift;
+            do {
+                *sift-- = *siftPrev;
+            } while (tmp < *--siftPrev);
+            *sift = tmp;
+        }
+    }
+}
+
+// Insertion sort that aborts once it has moved too many elements; returns whether it finished.
+bool partialInsertionSort(int* begin, int* end) {
+    if (begin == end) return true;
+
+    std::size_t moved = 0;
+    for (int* cur = begin + 1; cur != end; ++cur) {
+        int* sift = cur;
+        int* siftPrev = cur - 1;
+        if (*sift < *siftPrev) {
+            int tmp = *sift;
+            do {
+                *sift-- = *siftPrev;
+            } while (sift != begin && tmp < *--siftPrev);
+            *sift = tmp;
+            moved += static_cast<std::size_t>(cur - sift);
+        }
+        if (moved > kPartialInsertionSortLimit) return false;
+    }
+    return true;
+}
+
+// Orders two elements in place.
+void sort2(int* a, int* b) {
+    if (*b < *a) std::iter_swap(a, b);
+}
+
+// Orders three elements in place.
+void sort3(int* a, int* b, int* c) {
+    sort2(a, b);
+    sort2(b, c);
+    sort2(a, b);
+}
+
+// Rounds a pointer up to the next cache line.
+unsigned char* alignCacheLine(unsigned char* p) {
+    std::uintptr_t ip = reinterpret_cast<std::uintptr_t>(p);
+    ip = (ip + kCacheLineSize - 1) & ~static_cast<std::uintptr_t>(kCacheLineSize - 1);
+    return reinterpret_cast<unsigned char*>(ip);
+}
+
+// Swaps the misplaced elements found by one round of block classification.
+void swapOffsets(int* first, int* last, const unsigned char* offsetsLeft, const unsigned char* offsetsRight,
+                 std::size_t num, bool useSwaps) {
+    if (useSwaps) {
+        // A cyclic rotation would break when both sides have the same count, so swap pairwise
+        for (std::size_t i = 0; i < num; ++i) {
+            std::iter_swap(first + offsetsLeft[i], last - offsetsRight[i]);
+        }
+    } else if (num > 0) {
+        int* l = first + offsetsLeft[0];
+        int* r = last - offsetsRight[0];
+        int tmp = *l;
+        *l = *r;
+        for (std::size_t i = 1; i < num; ++i) {
+            l = first + offsetsLeft[i];
+            *r = *l;
+            r = last - offsetsRight[i];
+            *l = *r;
+        }
+        *r = tmp;
+    }
+}
+
+// Partitions [begin, end) around *begin with branchless block classification (BlockQuicksort).
+// Elements equal to the pivot go right. Returns the pivot position and whether no swaps were needed.
+std::pair<int*, bool> partitionRight(int* begin, int* end) {
+    const int pivot = *begin;
+    int* first = begin;
+    int* last = end;
+
+    // The median-of-three placement guarantees a sentinel on the right for this scan
+    while (*++first < pivot) {}
+
+    if (first - 1 == begin) {
+        while (first < last && !(*--last < pivot)) {}
+    } else {
+        while (!(*--last < pivot)) {}
+    }
+
+    const bool alreadyPartitioned = first >= last;
+    if (!alreadyPartitioned) {
+        std::iter_swap(first, last);
+        ++first;
+
+        unsigned char offsetsLeftStorage[kBlockSize + kCacheLineSize];
+        unsigned char offsetsRightStorage[kBlockSize + kCacheLineSize];
+        unsigned char* offsetsLeft = alignCacheLine(offsetsLeftStorage);
+        unsigned char* offsetsRight = alignCacheLine(offsetsRightStorage);
+
+        int* offsetsLeftBase = first;
+        int* offsetsRightBase = last;
+        std::size_t numLeft = 0, numRight = 0, startLeft = 0, startRight = 0;
+
+        while (first < last) {
+            // Fill whichever offset buffers are empty, splitting the remaining range if both are
+            std::size_t numUnknown = static_cast<std::size_t>(last - first);
+            std::size_t leftSplit = numLeft == 0 ? (numRight == 0 ? numUnknown / 2 : numUnknown) : 0;
+            std::size_t rightSplit = numRight == 0 ? (numUnknown - leftSplit) : 0;
+
+            // Record offsets of elements that belong on the other side without branching on the comparison
+            std::size_t leftCount = std::min(leftSplit, kBlockSize);
+            for (std::size_t i = 0; i < leftCount; ++i) {
+                offsetsLeft[numLeft] = static_cast<unsigned char>(i);
+                numLeft += !(*first < pivot);
+                ++first;
+            }
+
+            std::size_t rightCount = std::min(rightSplit, kBlockSize);
+            for (std::size_t i = 0; i < rightCount;) {
+                offsetsRight[numRight] = static_cast<unsigned char>(++i);
+                numRight += *--last < pivot;
+            }
+
+            std::size_t num = std::min(numLeft, numRight);
+            swapOffsets(offsetsLeftBase, offsetsRightBase, offsetsLeft + startLeft, offsetsRight + startRight,
+                        num, numLeft == numRight);
+            numLeft -= num;
+            numRight -= num;
+            startLeft += num;
+            startRight += num;
+
+            if (numLeft == 0) {
+                startLeft = 0;
+                offsetsLeftBase = first;
+            }
+            if (numRight == 0) {
+                startRight = 0;
+                offsetsRightBase = last;
+            }
+        }
+
+        // One side may still hold misplaced elements; move them next to the boundary
+        if (numLeft) {
+            offsetsLeft += startLeft;
+            while (numLeft--) {
+                std::iter_swap(offsetsLeftBase + offsetsLeft[numLeft], --last);
+            }
+            first = last;
+        }
+        if (numRight) {
+            offsetsRight += startRight;
+            while (numRight--) {
+                std::iter_swap(offsetsRightBase - offsetsRight[numRight], first);
+                ++first;
+            }
+        }
+    }
+
+    int* pivotPos = first - 1;
+    *begin = *pivotPos;
+    *pivotPos = pivot;
+    return {pivotPos, alreadyPartitioned};
+}
+
+// Partitions around *begin putting equal elements left; used when the pivot repeats the
+// element before the range, which means the whole equal run can be skipped at once.
+int* partitionLeft(int* begin, int* end) {
+    const int pivot = *begin;
+    int* first = begin;
+    int* last = end;
+
+    while (pivot < *--last) {}
+
+    if (last + 1 == end) {
+        while (first < last && !(pivot < *++first)) {}
+    } else {
+        while (!(pivot < *++first)) {}
+    }
+
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (pivot < *--last) {}
+        while (!(pivot < *++first)) {}
+    }
+
+    int* pivotPos = last;
+    *begin = *pivotPos;
+    *pivotPos = pivot;
+    return pivotPos;
+}
+
+// Main loop: recurses on the left partition and iterates on the right one.
+void pdqsortLoop(int* begin, int* end, int badAllowed, bool leftmost) {
+    while (true) {
+        std::ptrdiff_t size = end - begin;
+
+        if (size < kInsertionSortThreshold) {
+            if (leftmost) {
+                insertionSort(begin, end);
+            } else {
+                unguardedInsertionSort(begin, end);
+            }
+            return;
+        }
+
+        // Move the pivot candidate to *begin
+        std::ptrdiff_t half = size / 2;
+        if (size > kNintherThreshold) {
+            sort3(begin, begin + half, end - 1);
+            sort3(begin + 1, begin + (half - 1), end - 2);
+            sort3(begin + 2, begin + (half + 1), end - 3);
+            sort3(begin + (half - 1), begin + half, begin + (half + 1));
+            std::iter_swap(begin, begin + half);
+        } else {
+            sort3(begin + half, begin, end - 1);
+        }
+
+        // A pivot equal to the previous partition's pivot means this range starts with a run of equal keys
+        if (!leftmost && !(*(begin - 1) < *begin)) {
+            begin = partitionLeft(begin, end) + 1;
+            continue;
+        }
+
+        auto [pivotPos, alreadyPartitioned] = partitionRight(begin, end);
+
+        std::ptrdiff_t leftSize = pivotPos - begin;
+        std::ptrdiff_t rightSize = end - (pivotPos + 1);
+        bool highlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+        if (highlyUnbalanced) {
+            // Too many bad partitions: fall back to heapsort for O(n log n) worst case
+            if (--badAllowed == 0) {
+                std::make_heap(begin, end);
+                std::sort_heap(begin, end);
+                return;
+            }
+
+            // Shuffle a few elements to break the pattern that produced the bad pivot
+            if (leftSize >= kInsertionSortThreshold) {
+                std::iter_swap(begin, begin + leftSize / 4);
+                std::iter_swap(pivotPos - 1, pivotPos - leftSize / 4);
+                if (leftSize > kNintherThreshold) {
+                    std::iter_swap(begin + 1, begin + (leftSize / 4 + 1));
+                    std::iter_swap(begin + 2, begin + (leftSize / 4 + 2));
+                    std::iter_swap(pivotPos - 2, pivotPos - (leftSize / 4 + 1));
+                    std::iter_swap(pivotPos - 3, pivotPos - (leftSize / 4 + 2));
+                }
+            }
+            if (rightSize >= kInsertionSortThreshold) {
+                std::iter_swap(pivotPos + 1, pivotPos + (1 + rightSize / 4));
+                std::iter_swap(end - 1, end - rightSize / 4);
+                if (rightSize > kNintherThreshold) {
+                    std::iter_swap(pivotPos + 2, pivotPos + (2 + rightSize / 4));
+                    std::iter_swap(pivotPos + 3, pivotPos + (3 + rightSize / 4));
+                    std::iter_swap(end - 2, end - (1 + rightSize / 4));
+                    std::iter_swap(end - 3, end - (2 + rightSize / 4));
+                }
+            }
+        } else if (alreadyPartitioned &&
+                   partialInsertionSort(begin, pivotPos) &&
+                   partialInsertionSort(pivotPos + 1, end)) {
+            // The input looked sorted and a few cheap insertions finished it
+            return;
+        }
+
+        pdqsortLoop(begin, pivotPos, badAllowed, leftmost);
+        begin = pivotPos + 1;
+        leftmost = false;
+    }
+}
+} // namespace
+
+// Prints the array on a single line.
+void PdqSort::display(const std::vector<int>& elements) {
+    for (const int& val : elements) {
+        std::cout << val << " ";
+    }
+    std::cout << std::endl;
+}
+
+// Sorts with pdqsort, allowing log2(n) bad partitions before switching to heapsort.
+void PdqSort::sort(std::vector<int>& elements) {
+    if (elements.size() < 2) {
+        return;
+    }
+
+    int badAllowed = 0;
+    for (std::size_t size = elements.size(); size > 0; size >>= 1) {
+        ++badAllowed;
+    }
+
+    pdqsortLoop(elements.data(), elements.data() + elements.size(), badAllowed, true);
+}
+
+// Runs the sort on a copy of the elements.
+void PdqSort::execute(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+    sort(elements);
+}
+
+// Partitions happen in blocks, so only the before/after states are shown.
+void PdqSort::executeAndDisplay(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+
+    display(elements);
+    sort(elements);
+    display(elements);
+}
+
+// Returns the algorithm's name.
+std::string PdqSort::getName() const {
+    return "Pattern-Defeating Quicksort";
+}
@@ -0,0 +1,221 @@
+// src/algorithm/QuickSelect.cpp
+#include "../../include/algorithm/QuickSelect.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Namespace for internal linkage
+namespace {
+// Ranges at or below this size are finished with insertion sort.
+constexpr std::size_t kSmallRange = 16;
+// Ranges above this size take Tukey's ninther as the pivot.
+constexpr std::size_t kNintherThreshold = 128;
+// Floyd-Rivest only samples ranges larger than this.
+constexpr std::ptrdiff_t kSampleThreshold = 600;
+
+// Sorts a short range in place.
+void insertionSort(int* data, std::size_t n) {
+    for (std::size_t i = 1; i < n; ++i) {
+        int key = data[i];
+        std::size_t j = i;
+        while (j > 0 && data[j - 1] > key) {
+            data[j] = data[j - 1];
+            --j;
+        }
+        data[j] = key;
+    }
+}
+
+// Median of three values without moving anything.
+int medianOfThree(int a, int b, int c) {
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+// Dijkstra three-way partition of [lo, hi) around pivot; returns the [lt, gt) range equal to it.
+std::pair<std::size_t, std::size_t> partitionThreeWay(int* data, std::size_t lo, std::size_t hi, int pivot) {
+    std::size_t lt = lo, i = lo, gt = hi;
+    while (i < gt) {
+        if (data[i] < pivot) {
+            std::swap(data[lt++], data[i++]);
+        } else if (pivot < data[i]) {
+            std::swap(data[i], data[--gt]);
+        } else {
+            ++i;
+        }
+    }
+    return {lt, gt};
+}
+
+// Hoare partition of [lo, hi) around a pivot value sampled from the range. Returns split with
+// [lo, split) <= pivot <= [split, hi). Both sides are non-empty because a median of samples is
+// never a unique maximum, so the right side always keeps at least one element.
+std::size_t partitionHoare(int* data, std::size_t lo, std::size_t hi, int pivot) {
+    std::size_t i = lo;
+    std::size_t j = hi - 1;
+    while (true) {
+        while (data[i] < pivot) ++i;
+        while (pivot < data[j]) --j;
+        if (i >= j) {
+            return j + 1;
+        }
+        std::swap(data[i++], data[j--]);
+    }
+}
+
+int selectDeterministic(int* data, std::size_t n, std::size_t index);
+
+// Median of medians of groups of five; guarantees at least 30% of the range on each side of the pivot.
+int medianOfMedians(int* data, std::size_t n) {
+    if (n <= 5) {
+        insertionSort(data, n);
+        return data[n / 2];
+    }
+
+    // Gather the group medians at the front, then select their median recursively
+    std::size_t medians = 0;
+    for (std::size_t i = 0; i < n; i += 5) {
+        std::size_t length = std::min<std::size_t>(5, n - i);
+        insertionSort(data + i, length);
+        std::swap(data[medians++], data[i + length / 2]);
+    }
+    return selectDeterministic(data, medians, medians / 2);
+}
+
+// Worst-case linear selection using only median-of-medians pivots.
+int selectDeterministic(int* data, std::size_t n, std::size_t index) {
+    std::size_t lo = 0, hi = n;
+    while (hi - lo > kSmallRange) {
+        int pivot = medianOfMedians(data + lo, hi - lo);
+        auto [lt, gt] = partitionThreeWay(data, lo, hi, pivot);
+        if (index < lt) {
+            hi = lt;
+        } else if (index >= gt) {
+            lo = gt;
+        } else {
+            return pivot;
+        }
+    }
+    insertionSort(data + lo, hi - lo);
+    return data[index];
+}
+} // namespace
+
+// Quickselect with median-of-three pivots; after 2*log2(n) rounds without finishing it switches to
+// median-of-medians pivots, which bounds the worst case at O(n).
+int QuickSelect::introselect(int* data, std::size_t n, std::size_t index) {
+    std::size_t lo = 0, hi = n;
+    int budget = 0;
+    for (std::size_t size = n; size > 1; size >>= 1) {
+        budget += 2;
+    }
+
+    while (hi - lo > kSmallRange) {
+        if (budget-- == 0) {
+            return selectDeterministic(data + lo, hi - lo, index - lo);
+        }
+
+        const std::size_t size = hi - lo;
+        const std::size_t mid = lo + size / 2;
+        int pivot;
+        if (size > kNintherThreshold) {
+            const std::size_t step = size / 8;
+            pivot = medianOfThree(medianOfThree(data[lo], data[lo + step], data[lo + 2 * step]),
+                                  medianOfThree(data[mid - step], data[mid], data[mid + step]),
+                                  medianOfThree(data[hi - 1 - 2 * step], data[hi - 1 - step], data[hi - 1]));
+        } else {
+            pivot = medianOfThree(data[lo], data[mid], data[hi - 1]);
+        }
+        std::size_t split = partitionHoare(data, lo, hi, pivot);
+        if (index < split) {
+            hi = split;
+        } else {
+            lo = split;
+        }
+    }
+    insertionSort(data + lo, hi - lo);
+    return data[index];
+}
+
+// Floyd and Rivest (1975): for large ranges, first select within a sample of about n^(2/3) elements
+// so the partition bounds land just around index, leaving very little to the final partition.
+int QuickSelect::floydRivest(int* data, std::size_t n, std::size_t index) {
+    std::ptrdiff_t left = 0;
+    std::ptrdiff_t right = static_cast<std::ptrdiff_t>(n) - 1;
+    const std::ptrdiff_t k = static_cast<std::ptrdiff_t>(index);
+
+    while (right > left) {
+        if (right - left > kSampleThreshold) {
+            const double size = static_cast<double>(right - left + 1);
+            const double rank = static_cast<double>(k - left + 1);
+            const double z = std::log(size);
+            const double sample = 0.5 * std::exp(2.0 * z / 3.0);
+            const double deviation = 0.5 * std::sqrt(z * sample * (size - sample) / size) * (rank < size / 2 ? -1.0 : 1.0);
+            const std::ptrdiff_t newLeft = std::max(left, static_cast<std::ptrdiff_t>(k - rank * sample / size + deviation));
+            const std::ptrdiff_t newRight = std::min(right, static_cast<std::ptrdiff_t>(k + (size - rank) * sample / size + deviation));
+            floydRivest(data + newLeft, static_cast<std::size_t>(newRight - newLeft + 1), static_cast<std::size_t>(k - newLeft));
+        }
+
+        // Partition [left, right] around data[k], which the sample step placed close to its final rank
+        const int pivot = data[k];
+        std::ptrdiff_t i = left;
+        std::ptrdiff_t j = right;
+        std::swap(data[left], data[k]);
+        if (data[right] > pivot) {
+            std::swap(data[right], data[left]);
+        }
+        while (i < j) {
+            std::swap(data[i], data[j]);
+            ++i;
+            --j;
+            while (data[i] < pivot) ++i;
+            while (data[j] > pivot) --j;
+        }
+        if (data[left] == pivot) {
+            std::swap(data[left], data[j]);
+        } else {
+            ++j;
+            std::swap(data[j], data[right]);
+        }
+
+        if (j <= k) left = j + 1;
+        if (k <= j) right = j - 1;
+    }
+    return data[k];
+}
+
+// Every method works on ascending order, so the k-th largest is the (n - k)-th smallest.
+int QuickSelect::select(std::vector<int>& elements) {
+    const std::size_t n = elements.size();
+    const std::size_t index = isSmallest ? static_cast<std::size_t>(k - 1) : n - static_cast<std::size_t>(k);
+
+    switch (method) {
+        case Method::FLOYD_RIVEST:
+            return floydRivest(elements.data(), n, index);
+        case Method::NTH_ELEMENT:
+            std::nth_element(elements.begin(), elements.begin() + index, elements.end());
+            return elements[index];
+        case Method::INTROSELECT:
+        default:
+            return introselect(elements.data(), n, index);
+    }
+}
+
+// Returns the algorithm's name.
+std::string QuickSelect::getName() const {
+    switch (method) {
+        case Method::FLOYD_RIVEST:
+            return "Floyd-Rivest Selection";
+        case Method::NTH_ELEMENT:
+            return "std::nth_element";
+        case Method::INTROSELECT:
+        default:
+            return "Introselect (median-of-medians fallback)";
+    }
+}
+
+// Chooses the selection method.
+void QuickSelect::setMethod(Method choice) {
+    method = choice;
+}
@@ -0,0 +1,254 @@
+// src/algorithm/RawBufferAlgorithm.cpp
+#include "../../include/algorithm/RawBufferAlgorithm.hpp"
+#include "../../include/core/WorkStealingThreadPool.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+
+// Namespace for internal linkage
+namespace {
+// Arena alignment promised to plugins; one cache line.
+constexpr std::size_t kArenaAlignment = 64;
+
+// Sentinel for "no rank chosen": select the median.
+constexpr std::size_t kMedianRank = static_cast<std::size_t>(-1);
+
+// Fields every version-1 descriptor has, up to and including run.
+constexpr std::size_t kMinInfoSize = offsetof(RaystructPluginInfo, run) + sizeof(RaystructPluginInfo::run);
+
+// Trampoline from the C pool handle to the host pool.
+void runPoolTasks(void* handle, unsigned tasks, RaystructTaskFn fn, void* arg) {
+    static_cast<ThreadPool*>(handle)->runTasks(tasks, [fn, arg](unsigned t) { fn(arg, t); });
+}
+
+// Operation the host requests: sorting when offered, selection otherwise.
+std::uint32_t operationFor(std::uint64_t capabilities) {
+    return (capabilities & RAYSTRUCT_CAP_SORT) ? RAYSTRUCT_OP_SORT : RAYSTRUCT_OP_SELECT;
+}
+} // namespace
+
+// std::aligned_alloc memory must go back through free.
+void RawBufferAlgorithm::AlignedFree::operator()(unsigned char* block) const {
+    std::free(block);
+}
+
+// Keeps the descriptor; buffers are created on the first prepare().
+RawBufferAlgorithm::RawBufferAlgorithm(const RaystructPluginInfo* pluginInfo)
+    : info(pluginInfo), selectionRank(kMedianRank) {}
+
+// Rejects descriptors the host cannot drive safely.
+bool RawBufferAlgorithm::isUsable(const RaystructPluginInfo* pluginInfo, std::string& error) {
+    if (!pluginInfo) {
+        error = "entry point returned no descriptor";
+        return false;
+    }
+    if (pluginInfo->abi_version != RAYSTRUCT_PLUGIN_ABI_VERSION) {
+        error = "plugin targets ABI version " + std::to_string(pluginInfo->abi_version) + ", host provides "
+            + std::to_string(RAYSTRUCT_PLUGIN_ABI_VERSION);
+        return false;
+    }
+    if (pluginInfo->struct_size < kMinInfoSize) {
+        error = "descriptor is smaller than a version " + std::to_string(RAYSTRUCT_PLUGIN_ABI_VERSION) + " descriptor";
+        return false;
+    }
+    if (!pluginInfo->run) {
+        error = "descriptor has no run entry point";
+        return false;
+    }
+    if (!(pluginInfo->capabilities & (RAYSTRUCT_CAP_SORT | RAYSTRUCT_CAP_SELECT))) {
+        error = "plugin declares neither sorting nor selection";
+        return false;
+    }
+    if (!(pluginInfo->capabilities & (RAYSTRUCT_CAP_INT32 | RAYSTRUCT_CAP_INT64))) {
+        error = "plugin declares no supported element width";
+        return false;
+    }
+    error.clear();
+    return true;
+}
+
+// 32-bit keys are copied as they are; 64-bit only plugins get sign-extended keys.
+void RawBufferAlgorithm::loadInput(const std::vector<int>& elements) {
+    const std::size_t width = (info->capabilities & RAYSTRUCT_CAP_INT32) ? sizeof(std::int32_t) : sizeof(std::int64_t);
+    const std::size_t bytes = elements.size() * width;
+    const std::size_t required = info->scratch_bytes ? info->scratch_bytes(elements.size(), width) : 0;
+
+    // Buffers are only reallocated when the input or the plugin's scratch request grows; a failed
+    // allocation surfaces like any other out-of-memory, as std::bad_alloc
+    auto allocate = [](std::size_t size) {
+        const std::size_t rounded = (std::max<std::size_t>(size, 1) + kArenaAlignment - 1) / kArenaAlignment * kArenaAlignment;
+        unsigned char* memory = static_cast<unsigned char*>(std::aligned_alloc(kArenaAlignment, rounded));
+        if (!memory) {
+            throw std::bad_alloc();
+        }
+        return AlignedBuffer(memory);
+    };
+    if (!input || bytes > length * elementWidth) {
+        input = allocate(bytes);
+        working = allocate(bytes);
+    }
+    if (!scratch || required > scratchBytes) {
+        scratch = allocate(required);
+        scratchBytes = required;
+    }
+
+    length = elements.size();
+    elementWidth = width;
+    if (width == sizeof(std::int32_t)) {
+        std::memcpy(input.get(), elements.data(), bytes);
+    } else {
+        std::int64_t* wide = reinterpret_cast<std::int64_t*>(input.get());
+        for (std::size_t i = 0; i < length; ++i) {
+            wide[i] = elements[i];
+        }
+    }
+
+    // Touch every page now so first-use faults stay out of the timing
+    std::memcpy(working.get(), input.get(), bytes);
+    std::memset(scratch.get(), 0, scratchBytes);
+    prepared = true;
+}
+
+// Restores the input and hands the plugin raw pointers into the host buffers.
+int RawBufferAlgorithm::runOnce() {
+    std::memcpy(working.get(), input.get(), length * elementWidth);
+
+    ThreadPool& pool = WorkStealingThreadPool::poolFor(context);
+    RaystructPool poolHandle{&pool, isParallel() ? threadCount : 1u, &runPoolTasks};
+
+    RaystructCall call{};
+    call.struct_size = sizeof(RaystructCall);
+    call.operation = operationFor(info->capabilities);
+    call.data = working.get();
+    call.length = length;
+    call.element_width = elementWidth;
+    call.k = length == 0 ? 0 : std::min(selectionRank == kMedianRank ? length / 2 : selectionRank, length - 1);
+    call.scratch = scratch.get();
+    call.scratch_bytes = scratchBytes;
+    call.pool = &poolHandle;
+    return info->run(&call);
+}
+
+// Packing happens here so the benchmark does not time it.
+void RawBufferAlgorithm::prepare(DataStructure* ds) {
+    loadInput(ds->getElements());
+}
+
+// Tight loop over the C entry point; the first failure stops the loop and throws, so the aborted call is
+// never reported as a time.
+void RawBufferAlgorithm::execute(DataStructure* ds) {
+    if (!prepared) {
+        loadInput(ds->getElements());
+    }
+    for (std::size_t r = 0; r < repetitions; ++r) {
+        lastStatus = runOnce();
+        if (lastStatus != 0) {
+            throw std::runtime_error(std::string(info->name) + " returned error code " + std::to_string(lastStatus));
+        }
+    }
+}
+
+// Shows the input and either the sorted array or the selected element.
+void RawBufferAlgorithm::executeAndDisplay(DataStructure* ds) {
+    loadInput(ds->getElements());
+    std::cout << "Input: ";
+    display(ds->getElements());
+
+    lastStatus = runOnce();
+    if (lastStatus != 0) {
+        std::cout << info->name << " returned error code " << lastStatus << std::endl;
+        return;
+    }
+
+    std::vector<int> output = getOutput();
+    if (operationFor(info->capabilities) == RAYSTRUCT_OP_SORT || output.empty()) {
+        std::cout << "Sorted: ";
+        display(output);
+    } else {
+        const std::size_t k = std::min(selectionRank == kMedianRank ? length / 2 : selectionRank, length - 1);
+        std::cout << "Element of rank " << k << ": " << output[k] << std::endl;
+    }
+}
+
+// Same one-line format as the built-in sorts.
+void RawBufferAlgorithm::display(const std::vector<int>& elements) {
+    for (const int& val : elements) {
+        std::cout << val << " ";
+    }
+    std::cout << std::endl;
+}
+
+// Widens or narrows the working buffer back to the harness' element type.
+std::vector<int> RawBufferAlgorithm::getOutput() const {
+    std::vector<int> output(length);
+    if (length == 0) {
+        return output;
+    }
+    if (elementWidth == sizeof(std::int32_t)) {
+        std::memcpy(output.data(), working.get(), length * elementWidth);
+    } else {
+        const std::int64_t* wide = reinterpret_cast<const std::int64_t*>(working.get());
+        for (std::size_t i = 0; i < length; ++i) {
+            output[i] = static_cast<int>(wide[i]);
+        }
+    }
+    return output;
+}
+
+// Names the plugin and marks it as a raw-ABI build.
+std::string RawBufferAlgorithm::getName() const {
+    std::string name = std::string(info->name ? info->name : "Unnamed plugin") + " (raw ABI v"
+        + std::to_string(info->abi_version);
+    if (isParallel() && threadCount > 1) {
+        name += ", " + std::to_string(threadCount) + " threads";
+    }
+    name += ")";
+    if (repetitions > 1) {
+        name += " x" + std::to_string(repetitions);
+    }
+    return name;
+}
+
+// Number of plugin calls per execute().
+std::size_t RawBufferAlgorithm::getRepetitions() const {
+    return repetitions;
+}
+
+// Parallel only when the plugin says it uses the pool.
+bool RawBufferAlgorithm::isParallel() const {
+    return (info->capabilities & RAYSTRUCT_CAP_PARALLEL) != 0;
+}
+
+// Stores the task count offered to the plugin (at least one).
+void RawBufferAlgorithm::setThreadCount(unsigned threads) {
+    threadCount = std::max(1u, threads);
+}
+
+// Getter for the task count.
+unsigned RawBufferAlgorithm::getThreadCount() const {
+    return isParallel() ? threadCount : 1;
+}
+
+// Stores the repetition count (at least one).
+void RawBufferAlgorithm::setRepetitions(std::size_t count) {
+    repetitions = std::max<std::size_t>(1, count);
+}
+
+// Out-of-range ranks are clamped to the last element at call time.
+void RawBufferAlgorithm::setSelectionRank(std::size_t rank) {
+    selectionRank = rank;
+}
+
+// Status of the most recent call.
+int RawBufferAlgorithm::getLastStatus() const {
+    return lastStatus;
+}
+
+// Descriptor accessor.
+const RaystructPluginInfo& RawBufferAlgorithm::getInfo() const {
+    return *info;
+}
@@ -0,0 +1,573 @@
+// src/algorithm/SimdKernels.cpp
+#include "../../include/algorithm/SimdKernels.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <vector>
+
+// The vector paths are only compiled for x86 with GCC/Clang; everything else falls back to scalar code.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define RAYSTRUCT_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+// Namespace for internal linkage
+namespace {
+// Block size finished by insertion sort when no vector unit is used.
+constexpr std::size_t kScalarSmallCapacity = 16;
+
+// One compare-exchange layer of a bitonic network described per lane:
+// every lane reads its partner through perm and keeps the max where takeMax is set.
+struct LaneStep {
+    alignas(32) int perm[8];
+    alignas(32) int takeMax[8];
+};
+
+// Builds layer (k, j) of a bitonic sorting network over the given number of lanes.
+constexpr LaneStep makeLaneStep(int lanes, int k, int j) {
+    LaneStep step{};
+    for (int i = 0; i < lanes; ++i) {
+        int partner = i ^ j;
+        bool ascending = (i & k) == 0;
+        step.perm[i] = partner;
+        step.takeMax[i] = ((i < partner) == ascending) ? 0 : -1;
+    }
+    return step;
+}
+
+// Full bitonic sort of one register, followed by the layers that finish a bitonic merge.
+constexpr LaneStep kSort8Steps[] = {
+    makeLaneStep(8, 2, 1), makeLaneStep(8, 4, 2), makeLaneStep(8, 4, 1),
+    makeLaneStep(8, 8, 4), makeLaneStep(8, 8, 2), makeLaneStep(8, 8, 1)
+};
+constexpr LaneStep kMerge8Steps[] = {
+    makeLaneStep(8, 16, 4), makeLaneStep(8, 16, 2), makeLaneStep(8, 16, 1)
+};
+constexpr LaneStep kSort4Steps[] = {
+    makeLaneStep(4, 2, 1), makeLaneStep(4, 4, 2), makeLaneStep(4, 4, 1)
+};
+constexpr LaneStep kMerge4Steps[] = {
+    makeLaneStep(4, 8, 2), makeLaneStep(4, 8, 1)
+};
+
+// Lane permutations that pack the lanes selected by a movemask to the front of the register.
+struct CompressTable8 {
+    alignas(32) int perm[256][8];
+};
+
+constexpr CompressTable8 makeCompressTable8() {
+    CompressTable8 table{};
+    for (int mask = 0; mask < 256; ++mask) {
+        int out = 0;
+        for (int lane = 0; lane < 8; ++lane) {
+            if (mask & (1 << lane)) table.perm[mask][out++] = lane;
+        }
+        for (int lane = 0; lane < 8; ++lane) {
+            if (!(mask & (1 << lane))) table.perm[mask][out++] = lane;
+        }
+    }
+    return table;
+}
+
+// Same packing for 4 lanes, expressed as pshufb byte shuffles.
+struct CompressTable4 {
+    alignas(16) unsigned char shuffle[16][16];
+};
+
+constexpr CompressTable4 makeCompressTable4() {
+    CompressTable4 table{};
+    for (int mask = 0; mask < 16; ++mask) {
+        int out = 0;
+        for (int pass = 0; pass < 2; ++pass) {
+            for (int lane = 0; lane < 4; ++lane) {
+                bool selected = (mask & (1 << lane)) != 0;
+                if (selected != (pass == 0)) continue;
+                for (int byte = 0; byte < 4; ++byte) {
+                    table.shuffle[mask][out * 4 + byte] = static_cast<unsigned char>(lane * 4 + byte);
+                }
+                ++out;
+            }
+        }
+    }
+    return table;
+}
+
+constexpr CompressTable8 kCompress8 = makeCompressTable8();
+constexpr CompressTable4 kCompress4 = makeCompressTable4();
+
+// Insertion sort used for small blocks on the scalar path.
+void insertionSortSmall(int* data, std::size_t n) {
+    for (std::size_t i = 1; i < n; ++i) {
+        int key = data[i];
+        std::size_t j = i;
+        while (j > 0 && data[j - 1] > key) {
+            data[j] = data[j - 1];
+            --j;
+        }
+        data[j] = key;
+    }
+}
+
+// Scalar partition with the same contract as the vector versions.
+std::size_t partitionScalar(int* data, std::size_t n, int pivot, bool inclusive, int* scratch) {
+    std::size_t left = 0, right = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        int value = data[i];
+        bool goesLeft = inclusive ? value <= pivot : value < pivot;
+        if (goesLeft) {
+            data[left++] = value;
+        } else {
+            scratch[right++] = value;
+        }
+    }
+    std::memcpy(data + left, scratch, right * sizeof(int));
+    return left;
+}
+
+// Scalar filter with the same contract as the vector versions.
+std::size_t filterScalar(const int* data, std::size_t n, int threshold, bool above, int* out) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        int value = data[i];
+        out[count] = value;
+        count += above ? value > threshold : value < threshold;
+    }
+    return count;
+}
+
+#ifdef RAYSTRUCT_X86_SIMD
+// Applies one network layer to a register of 8 keys.
+__attribute__((target("avx2")))
+inline __m256i avx2Layer(__m256i v, const LaneStep& step) {
+    __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(step.perm));
+    __m256i takeMax = _mm256_load_si256(reinterpret_cast<const __m256i*>(step.takeMax));
+    __m256i other = _mm256_permutevar8x32_epi32(v, perm);
+    return _mm256_blendv_epi8(_mm256_min_epi32(v, other), _mm256_max_epi32(v, other), takeMax);
+}
+
+// Sorts up to 16 keys held in two registers, padding unused lanes with INT_MAX.
+__attribute__((target("avx2")))
+void sortSmallAvx2(int* data, std::size_t n) {
+    alignas(32) int block[16];
+    for (std::size_t i = 0; i < 16; ++i) {
+        block[i] = i < n ? data[i] : INT_MAX;
+    }
+
+    __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(block));
+    for (const LaneStep& step : kSort8Steps) {
+        a = avx2Layer(a, step);
+    }
+
+    if (n > 8) {
+        __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(block + 8));
+        for (const LaneStep& step : kSort8Steps) {
+            b = avx2Layer(b, step);
+        }
+
+        // Reversing b makes a:b bitonic, so one min/max splits it into two bitonic halves
+        b = _mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        __m256i lo = _mm256_min_epi32(a, b);
+        __m256i hi = _mm256_max_epi32(a, b);
+        for (const LaneStep& step : kMerge8Steps) {
+            lo = avx2Layer(lo, step);
+            hi = avx2Layer(hi, step);
+        }
+        a = lo;
+        _mm256_store_si256(reinterpret_cast<__m256i*>(block + 8), hi);
+    }
+
+    _mm256_store_si256(reinterpret_cast<__m256i*>(block), a);
+    std::memcpy(data, block, n * sizeof(int));
+}
+
+// Packs keys below the pivot to the front of data and the rest into scratch, 8 lanes at a time.
+__attribute__((target("avx2")))
+std::size_t partitionAvx2(int* data, std::size_t n, int pivot, bool inclusive, int* scratch) {
+    const __m256i pivotVec = _mm256_set1_epi32(pivot);
+    std::size_t left = 0, right = 0, i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i greater = _mm256_cmpgt_epi32(v, pivotVec);
+        __m256i less = _mm256_cmpgt_epi32(pivotVec, v);
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(inclusive ? greater : less)));
+        if (inclusive) mask = ~mask & 0xFFu;
+
+        __m256i packedLeft = _mm256_permutevar8x32_epi32(
+            v, _mm256_load_si256(reinterpret_cast<const __m256i*>(kCompress8.perm[mask])));
+        __m256i packedRight = _mm256_permutevar8x32_epi32(
+            v, _mm256_load_si256(reinterpret_cast<const __m256i*>(kCompress8.perm[~mask & 0xFFu])));
+
+        // Full-width stores: lanes past the packed count are overwritten by later iterations
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + left), packedLeft);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(scratch + right), packedRight);
+
+        std::size_t count = static_cast<std::size_t>(__builtin_popcount(mask));
+        left += count;
+        right += 8 - count;
+    }
+
+    for (; i < n; ++i) {
+        int value = data[i];
+        bool goesLeft = inclusive ? value <= pivot : value < pivot;
+        if (goesLeft) {
+            data[left++] = value;
+        } else {
+            scratch[right++] = value;
+        }
+    }
+
+    std::memcpy(data + left, scratch, right * sizeof(int));
+    return left;
+}
+
+// Movemask of the lanes of v beyond the threshold.
+__attribute__((target("avx2")))
+inline unsigned filterMaskAvx2(__m256i v, __m256i thresholdVec, bool above) {
+    __m256i pass = above ? _mm256_cmpgt_epi32(v, thresholdVec) : _mm256_cmpgt_epi32(thresholdVec, v);
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(pass)));
+}
+
+// Packs the lanes selected by mask to out and returns how many were written.
+__attribute__((target("avx2")))
+inline std::size_t compressStoreAvx2(__m256i v, unsigned mask, int* out) {
+    __m256i packed = _mm256_permutevar8x32_epi32(
+        v, _mm256_load_si256(reinterpret_cast<const __m256i*>(kCompress8.perm[mask])));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), packed);
+    return static_cast<std::size_t>(__builtin_popcount(mask));
+}
+
+// Compress-stores the keys beyond threshold, 16 lanes per iteration. Once the threshold is tight almost
+// every block has an empty mask, so the loop is two compares, one OR and a predictable branch.
+__attribute__((target("avx2")))
+std::size_t filterAvx2(const int* data, std::size_t n, int threshold, bool above, int* out) {
+    const __m256i thresholdVec = _mm256_set1_epi32(threshold);
+    std::size_t count = 0, i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8));
+        unsigned maskA = filterMaskAvx2(a, thresholdVec, above);
+        unsigned maskB = filterMaskAvx2(b, thresholdVec, above);
+        if ((maskA | maskB) == 0) {
+            continue;
+        }
+        count += compressStoreAvx2(a, maskA, out + count);
+        count += compressStoreAvx2(b, maskB, out + count);
+    }
+
+    return count + filterScalar(data + i, n - i, threshold, above, out + count);
+}
+
+// Applies one network layer to a register of 4 keys using an immediate shuffle.
+template <int Shuffle>
+__attribute__((target("sse4.1")))
+inline __m128i sse4Layer(__m128i v, const LaneStep& step) {
+    __m128i takeMax = _mm_load_si128(reinterpret_cast<const __m128i*>(step.takeMax));
+    __m128i other = _mm_shuffle_epi32(v, Shuffle);
+    return _mm_blendv_epi8(_mm_min_epi32(v, other), _mm_max_epi32(v, other), takeMax);
+}
+
+// Shuffle immediates for partners i ^ 1, i ^ 2 and the full reversal.
+constexpr int kSwapPairs = _MM_SHUFFLE(2, 3, 0, 1);
+constexpr int kSwapHalves = _MM_SHUFFLE(1, 0, 3, 2);
+constexpr int kReverse = _MM_SHUFFLE(0, 1, 2, 3);
+
+// Sorts up to 8 keys held in two registers, padding unused lanes with INT_MAX.
+__attribute__((target("sse4.1")))
+void sortSmallSse4(int* data, std::size_t n) {
+    alignas(16) int block[8];
+    for (std::size_t i = 0; i < 8; ++i) {
+        block[i] = i < n ? data[i] : INT_MAX;
+    }
+
+    __m128i a = _mm_load_si128(reinterpret_cast<const __m128i*>(block));
+    __m128i b = _mm_load_si128(reinterpret_cast<const __m128i*>(block + 4));
+    a = sse4Layer<kSwapPairs>(a, kSort4Steps[0]);
+    b = sse4Layer<kSwapPairs>(b, kSort4Steps[0]);
+    a = sse4Layer<kSwapHalves>(a, kSort4Steps[1]);
+    b = sse4Layer<kSwapHalves>(b, kSort4Steps[1]);
+    a = sse4Layer<kSwapPairs>(a, kSort4Steps[2]);
+    b = sse4Layer<kSwapPairs>(b, kSort4Steps[2]);
+
+    // Bitonic merge of the two sorted registers
+    b = _mm_shuffle_epi32(b, kReverse);
+    __m128i lo = _mm_min_epi32(a, b);
+    __m128i hi = _mm_max_epi32(a, b);
+    lo = sse4Layer<kSwapHalves>(lo, kMerge4Steps[0]);
+    hi = sse4Layer<kSwapHalves>(hi, kMerge4Steps[0]);
+    lo = sse4Layer<kSwapPairs>(lo, kMerge4Steps[1]);
+    hi = sse4Layer<kSwapPairs>(hi, kMerge4Steps[1]);
+
+    _mm_store_si128(reinterpret_cast<__m128i*>(block), lo);
+    _mm_store_si128(reinterpret_cast<__m128i*>(block + 4), hi);
+    std::memcpy(data, block, n * sizeof(int));
+}
+
+// 4-lane version of partitionAvx2 built on pshufb compression.
+__attribute__((target("sse4.1")))
+std::size_t partitionSse4(int* data, std::size_t n, int pivot, bool inclusive, int* scratch) {
+    const __m128i pivotVec = _mm_set1_epi32(pivot);
+    std::size_t left = 0, right = 0, i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i greater = _mm_cmpgt_epi32(v, pivotVec);
+        __m128i less = _mm_cmplt_epi32(v, pivotVec);
+        unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(inclusive ? greater : less)));
+        if (inclusive) mask = ~mask & 0xFu;
+
+        __m128i packedLeft = _mm_shuffle_epi8(
+            v, _mm_load_si128(reinterpret_cast<const __m128i*>(kCompress4.shuffle[mask])));
+        __m128i packedRight = _mm_shuffle_epi8(
+            v, _mm_load_si128(reinterpret_cast<const __m128i*>(kCompress4.shuffle[~mask & 0xFu])));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + left), packedLeft);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(scratch + right), packedRight);
+
+        std::size_t count = static_cast<std::size_t>(__builtin_popcount(mask));
+        left += count;
+        right += 4 - count;
+    }
+
+    for (; i < n; ++i) {
+        int value = data[i];
+        bool goesLeft = inclusive ? value <= pivot : value < pivot;
+        if (goesLeft) {
+            data[left++] = value;
+        } else {
+            scratch[right++] = value;
+        }
+    }
+
+    std::memcpy(data + left, scratch, right * sizeof(int));
+    return left;
+}
+
+// 4-lane version of filterAvx2 built on pshufb compression.
+__attribute__((target("sse4.1")))
+std::size_t filterSse4(const int* data, std::size_t n, int threshold, bool above, int* out) {
+    const __m128i thresholdVec = _mm_set1_epi32(threshold);
+    std::size_t count = 0, i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i pass = above ? _mm_cmpgt_epi32(v, thresholdVec) : _mm_cmplt_epi32(v, thresholdVec);
+        unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(pass)));
+        if (mask == 0) {
+            continue;
+        }
+        __m128i packed = _mm_shuffle_epi8(
+            v, _mm_load_si128(reinterpret_cast<const __m128i*>(kCompress4.shuffle[mask])));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + count), packed);
+        count += static_cast<std::size_t>(__builtin_popcount(mask));
+    }
+
+    return count + filterScalar(data + i, n - i, threshold, above, out + count);
+}
+#endif
+
+// Returns the median of three values.
+int medianOfThree(int a, int b, int c) {
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+// Picks a pivot from the range, using Tukey's ninther on larger inputs.
+int choosePivot(const int* data, std::size_t n) {
+    if (n < 128) {
+        return medianOfThree(data[0], data[n / 2], data[n - 1]);
+    }
+    std::size_t step = n / 8;
+    return medianOfThree(medianOfThree(data[0], data[step], data[2 * step]),
+                         medianOfThree(data[n / 2 - step], data[n / 2], data[n / 2 + step]),
+                         medianOfThree(data[n - 1 - 2 * step], data[n - 1 - step], data[n - 1]));
+}
+
+// Quicksort loop that recurses into the smaller side and falls back to heapsort on bad pivots.
+void quickSort(int* data, std::size_t n, SimdLevel level, int* scratch, int depthLimit) {
+    const std::size_t smallCapacity = SimdKernels::smallSortCapacity(level);
+
+    while (n > smallCapacity) {
+        if (depthLimit-- == 0) {
+            std::make_heap(data, data + n);
+            std::sort_heap(data, data + n);
+            return;
+        }
+
+        int pivot = choosePivot(data, n);
+        std::size_t mid = SimdKernels::partition(data, n, pivot, false, scratch, level);
+
+        // The pivot was the minimum: peel off every copy of it so the range always shrinks
+        if (mid == 0) {
+            mid = SimdKernels::partition(data, n, pivot, true, scratch, level);
+            data += mid;
+            n -= mid;
+            continue;
+        }
+
+        if (mid < n - mid) {
+            quickSort(data, mid, level, scratch, depthLimit);
+            data += mid;
+            n -= mid;
+        } else {
+            quickSort(data + mid, n - mid, level, scratch, depthLimit);
+            n = mid;
+        }
+    }
+
+    SimdKernels::sortSmall(data, n, level);
+}
+} // namespace
+
+// Queries CPUID once and caches the widest supported instruction set.
+SimdLevel SimdKernels::detectLevel() {
+#ifdef RAYSTRUCT_X86_SIMD
+    static const SimdLevel detected = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE4;
+        return SimdLevel::SCALAR;
+    }();
+    return detected;
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+// Never hands out a level the CPU cannot execute.
+SimdLevel SimdKernels::clampLevel(SimdLevel requested) {
+    SimdLevel supported = detectLevel();
+    return static_cast<int>(requested) > static_cast<int>(supported) ? supported : requested;
+}
+
+// Returns the label printed next to benchmark names.
+const char* SimdKernels::levelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2:
+            return "AVX2";
+        case SimdLevel::SSE4:
+            return "SSE4.1";
+        case SimdLevel::SCALAR:
+        default:
+            return "Scalar";
+    }
+}
+
+// Two registers worth of keys per small block.
+std::size_t SimdKernels::smallSortCapacity(SimdLevel level) {
+    switch (clampLevel(level)) {
+        case SimdLevel::AVX2:
+            return 16;
+        case SimdLevel::SSE4:
+            return 8;
+        case SimdLevel::SCALAR:
+        default:
+            return kScalarSmallCapacity;
+    }
+}
+
+// Dispatches the small-block sort to the requested instruction set.
+void SimdKernels::sortSmall(int* data, std::size_t n, SimdLevel level) {
+    if (n < 2) {
+        return;
+    }
+    switch (clampLevel(level)) {
+#ifdef RAYSTRUCT_X86_SIMD
+        case SimdLevel::AVX2:
+            sortSmallAvx2(data, n);
+            return;
+        case SimdLevel::SSE4:
+            sortSmallSse4(data, n);
+            return;
+#endif
+        default:
+            insertionSortSmall(data, n);
+            return;
+    }
+}
+
+// Dispatches the partition to the requested instruction set.
+std::size_t SimdKernels::partition(int* data, std::size_t n, int pivot, bool inclusive, int* scratch, SimdLevel level) {
+    switch (clampLevel(level)) {
+#ifdef RAYSTRUCT_X86_SIMD
+        case SimdLevel::AVX2:
+            return partitionAvx2(data, n, pivot, inclusive, scratch);
+        case SimdLevel::SSE4:
+            return partitionSse4(data, n, pivot, inclusive, scratch);
+#endif
+        default:
+            return partitionScalar(data, n, pivot, inclusive, scratch);
+    }
+}
+
+// Dispatches the filter to the requested instruction set.
+std::size_t SimdKernels::filter(const int* data, std::size_t n, int threshold, bool above, int* out, SimdLevel level) {
+    switch (clampLevel(level)) {
+#ifdef RAYSTRUCT_X86_SIMD
+        case SimdLevel::AVX2:
+            return filterAvx2(data, n, threshold, above, out);
+        case SimdLevel::SSE4:
+            return filterSse4(data, n, threshold, above, out);
+#endif
+        default:
+            return filterScalar(data, n, threshold, above, out);
+    }
+}
+
+// Sorts the range in place with the vectorized quicksort driver.
+void SimdKernels::sort(int* data, std::size_t n, SimdLevel level) {
+    if (n < 2) {
+        return;
+    }
+
+    level = clampLevel(level);
+    std::vector<int> scratch(n + 8);
+
+    int depthLimit = 0;
+    for (std::size_t size = n; size > 1; size >>= 1) {
+        depthLimit += 2;
+    }
+
+    quickSort(data, n, level, scratch.data(), depthLimit);
+}
+
+// Keeps only the side of each partition that holds index; bad pivot runs fall back to std::nth_element.
+int SimdKernels::select(int* data, std::size_t n, std::size_t index, SimdLevel level) {
+    level = clampLevel(level);
+    const std::size_t smallCapacity = smallSortCapacity(level);
+    std::vector<int> scratch(n + 8);
+
+    int budget = 0;
+    for (std::size_t size = n; size > 1; size >>= 1) {
+        budget += 2;
+    }
+
+    while (n > smallCapacity) {
+        if (budget-- == 0) {
+            std::nth_element(data, data + index, data + n);
+            return data[index];
+        }
+
+        int pivot = choosePivot(data, n);
+        std::size_t mid = partition(data, n, pivot, false, scratch.data(), level);
+
+        // The pivot was the minimum: split off every copy of it instead
+        if (mid == 0) {
+            mid = partition(data, n, pivot, true, scratch.data(), level);
+            if (index < mid) {
+                return pivot;
+            }
+        }
+
+        if (index < mid) {
+            n = mid;
+        } else {
+            data += mid;
+            n -= mid;
+            index -= mid;
+        }
+    }
+
+    sortSmall(data, n, level);
+    return data[index];
+}
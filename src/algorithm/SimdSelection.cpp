@@ -0,0 +1,77 @@
+// src/algorithm/SimdSelection.cpp
+#include "../../include/algorithm/SimdSelection.hpp"
+#include "../../include/algorithm/SimdKernels.hpp"
+#include "../../include/algorithm/TopKBuffer.hpp"
+#include <algorithm>
+#include <vector>
+
+// Namespace for internal linkage
+namespace {
+// Above k = n / kFilterRatio the threshold stays loose for too long and heap updates dominate,
+// so top-k mode partitions instead.
+constexpr std::size_t kFilterRatio = 256;
+} // namespace
+
+// Starts with the widest instruction set available on this machine.
+SimdSelection::SimdSelection() : level(SimdKernels::detectLevel()) {}
+
+// Maps k onto an ascending rank and lets the vectorized quickselect find it.
+int SimdSelection::selectPartition(std::vector<int>& elements) {
+    const std::size_t n = elements.size();
+    const std::size_t index = isSmallest ? static_cast<std::size_t>(k - 1) : n - static_cast<std::size_t>(k);
+    return SimdKernels::select(elements.data(), n, index, level);
+}
+
+// The k-th smallest keeps the k smallest keys (threshold filter "below"), the k-th largest the k largest.
+int SimdSelection::selectTopK(std::vector<int>& elements) {
+    const std::size_t count = static_cast<std::size_t>(k);
+
+    // Large k: quickselect leaves the k best keys on one side of the rank, so they are sliced out and sorted
+    if (count > elements.size() / kFilterRatio) {
+        const int kth = selectPartition(elements);
+        if (isSmallest) {
+            topK.assign(elements.begin(), elements.begin() + count);
+            SimdKernels::sort(topK.data(), topK.size(), level);
+        } else {
+            topK.assign(elements.end() - count, elements.end());
+            SimdKernels::sort(topK.data(), topK.size(), level);
+            std::reverse(topK.begin(), topK.end());
+        }
+        return kth;
+    }
+
+    TopKBuffer buffer(count, !isSmallest, level);
+    buffer.offer(elements.data(), elements.size());
+    topK = buffer.sortedBest();
+    return buffer.threshold();
+}
+
+// Runs the selected mode.
+int SimdSelection::select(std::vector<int>& elements) {
+    if (mode == Mode::TOP_K) {
+        return selectTopK(elements);
+    }
+    topK.clear();
+    return selectPartition(elements);
+}
+
+// Returns the algorithm's name along with the mode and instruction set in use.
+std::string SimdSelection::getName() const {
+    std::string name = std::string("SIMD Selection (") + SimdKernels::levelName(level);
+    return name + (mode == Mode::TOP_K ? " top-k filter)" : " quickselect)");
+}
+
+// Chooses how the statistic is computed.
+void SimdSelection::setMode(Mode choice) {
+    mode = choice;
+}
+
+// Lets benchmarks compare the AVX2, SSE4.1 and scalar paths on the same input.
+void SimdSelection::setSimdLevel(SimdLevel requested) {
+    level = SimdKernels::clampLevel(requested);
+}
+
+// Getter for the k best elements of the last top-k run.
+const std::vector<int>& SimdSelection::getTopK() const {
+    return topK;
+}
@@ -0,0 +1,46 @@
+// src/algorithm/SimdSort.cpp
+#include "../../include/algorithm/SimdSort.hpp"
+#include "../../include/algorithm/SimdKernels.hpp"
+#include <iostream>
+#include <vector>
+
+// Starts with the widest instruction set available on this machine.
+SimdSort::SimdSort() : level(SimdKernels::detectLevel()) {}
+
+// Prints the array on a single line.
+void SimdSort::display(const std::vector<int>& elements) {
+    for (const int& val : elements) {
+        std::cout << val << " ";
+    }
+    std::cout << std::endl;
+}
+
+// Sorts a copy of the elements with the vectorized kernels.
+void SimdSort::execute(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+    SimdKernels::sort(elements.data(), elements.size(), level);
+}
+
+// Sorting happens inside registers, so only the before/after states are shown.
+void SimdSort::executeAndDisplay(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+
+    display(elements);
+    SimdKernels::sort(elements.data(), elements.size(), level);
+    display(elements);
+}
+
+// Returns the algorithm's name along with the instruction set in use.
+std::string SimdSort::getName() const {
+    return std::string("SIMD Sort (") + SimdKernels::levelName(level) + ")";
+}
+
+// Lets benchmarks compare the AVX2, SSE4.1 and scalar paths on the same input.
+void SimdSort::setSimdLevel(SimdLevel requested) {
+    level = SimdKernels::clampLevel(requested);
+}
+
+// Getter for the active instruction set.
+SimdLevel SimdSort::getSimdLevel() const {
+    return level;
+}
@@ -0,0 +1,154 @@
+// src/algorithm/SortingNetworkSort.cpp
+#include "../../include/algorithm/SortingNetworkSort.hpp"
+#include "../../include/algorithm/SimdKernels.hpp"
+#include "../../include/algorithm/SortingNetwork.hpp"
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+// The vector paths are only compiled for x86 with GCC/Clang; everything else falls back to scalar code.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define RAYSTRUCT_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+// Namespace for internal linkage
+namespace {
+// Sorts one block of N elements after another.
+using BatchFn = void (*)(int* data, std::size_t blocks);
+
+// Scalar kernel: the per-width loop keeps the unrolled network inlined instead of dispatching per block.
+template <std::size_t N>
+void sortBlocksScalar(int* data, std::size_t blocks) {
+    for (std::size_t b = 0; b < blocks; ++b) {
+        SortingNetwork<N>::sort(data + b * N);
+    }
+}
+
+#ifdef RAYSTRUCT_X86_SIMD
+// Vertical compare-exchange: every lane orders its own pair of rows.
+__attribute__((target("avx2")))
+inline void compareExchangeRows(__m256i& a, __m256i& b) {
+    const __m256i low = _mm256_min_epi32(a, b);
+    b = _mm256_max_epi32(a, b);
+    a = low;
+}
+
+// Runs the whole network of width N on eight blocks, one per lane.
+template <std::size_t N, std::size_t... I>
+__attribute__((target("avx2")))
+inline void applyNetworkRows(__m256i* rows, std::index_sequence<I...>) {
+    (compareExchangeRows(rows[NetworkSchedule<N>::comparators[I].a], rows[NetworkSchedule<N>::comparators[I].b]), ...);
+}
+
+// AVX2 kernel: row i gathers element i of eight neighbouring blocks, so each comparator is one min/max pair
+// for all eight blocks. Leftover blocks go through the scalar network.
+template <std::size_t N>
+__attribute__((target("avx2")))
+void sortBlocksAvx2(int* data, std::size_t blocks) {
+    constexpr int stride = static_cast<int>(N);
+    const __m256i laneOffsets = _mm256_setr_epi32(0, stride, 2 * stride, 3 * stride,
+                                                  4 * stride, 5 * stride, 6 * stride, 7 * stride);
+    __m256i rows[N];
+    alignas(32) int lanes[8];
+
+    std::size_t b = 0;
+    for (; b + 8 <= blocks; b += 8) {
+        int* base = data + b * N;
+        for (std::size_t i = 0; i < N; ++i) {
+            rows[i] = _mm256_i32gather_epi32(base + i, laneOffsets, 4);
+        }
+
+        applyNetworkRows<N>(rows, std::make_index_sequence<NetworkSchedule<N>::comparators.size()>{});
+
+        // AVX2 has no scatter, so each row is spilled and written back lane by lane
+        for (std::size_t i = 0; i < N; ++i) {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), rows[i]);
+            for (std::size_t lane = 0; lane < 8; ++lane) {
+                base[lane * N + i] = lanes[lane];
+            }
+        }
+    }
+    sortBlocksScalar<N>(data + b * N, blocks - b);
+}
+#endif
+
+// Widths below two need no work, so the tables start at two.
+constexpr std::size_t kMinWidth = 2;
+
+template <std::size_t... Offsets>
+constexpr std::array<BatchFn, sizeof...(Offsets)> makeScalarTable(std::index_sequence<Offsets...>) {
+    return {{&sortBlocksScalar<Offsets + kMinWidth>...}};
+}
+
+constexpr auto kScalarKernels = makeScalarTable(std::make_index_sequence<SortingNetworks::kMaxSize - kMinWidth + 1>{});
+
+#ifdef RAYSTRUCT_X86_SIMD
+template <std::size_t... Offsets>
+constexpr std::array<BatchFn, sizeof...(Offsets)> makeAvx2Table(std::index_sequence<Offsets...>) {
+    return {{&sortBlocksAvx2<Offsets + kMinWidth>...}};
+}
+
+constexpr auto kAvx2Kernels = makeAvx2Table(std::make_index_sequence<SortingNetworks::kMaxSize - kMinWidth + 1>{});
+#endif
+} // namespace
+
+// Only the AVX2 kernels are vectorized, so narrower instruction sets use the scalar path.
+SortingNetworkSort::SortingNetworkSort() : simdAvailable(SimdKernels::detectLevel() == SimdLevel::AVX2) {}
+
+// Prints the array on a single line.
+void SortingNetworkSort::display(const std::vector<int>& elements) {
+    for (const int& val : elements) {
+        std::cout << val << " ";
+    }
+    std::cout << std::endl;
+}
+
+// Dispatches once per call to the kernel for this width, then sorts the partial tail block.
+void SortingNetworkSort::sortBatches(std::vector<int>& elements) const {
+    const std::size_t blocks = elements.size() / width;
+    BatchFn kernel = kScalarKernels[width - kMinWidth];
+#ifdef RAYSTRUCT_X86_SIMD
+    if (useSimd && simdAvailable) {
+        kernel = kAvx2Kernels[width - kMinWidth];
+    }
+#endif
+    kernel(elements.data(), blocks);
+
+    const std::size_t tail = elements.size() - blocks * width;
+    SortingNetworks::sort(elements.data() + blocks * width, tail);
+}
+
+// Sorts the blocks of a copy of the elements.
+void SortingNetworkSort::execute(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+    sortBatches(elements);
+}
+
+// Networks have no meaningful intermediate states, so only before/after are shown.
+void SortingNetworkSort::executeAndDisplay(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+
+    display(elements);
+    sortBatches(elements);
+    display(elements);
+}
+
+// Returns the algorithm's name with its configuration.
+std::string SortingNetworkSort::getName() const {
+    return "Sorting Network Batch (width " + std::to_string(width) + ", " +
+           std::to_string(SortingNetworks::comparatorCount(width)) + " comparators, " +
+           (useSimd && simdAvailable ? "AVX2 lanes" : "scalar") + ")";
+}
+
+// Keeps the width inside the range of generated networks.
+void SortingNetworkSort::setWidth(std::size_t size) {
+    width = std::clamp<std::size_t>(size, kMinWidth, SortingNetworks::kMaxSize);
+}
+
+// Stores the kernel preference; it only takes effect when AVX2 is available.
+void SortingNetworkSort::setUseSimd(bool enabled) {
+    useSimd = enabled;
+}
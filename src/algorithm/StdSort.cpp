@@ -0,0 +1,86 @@
+// src/algorithm/StdSort.cpp
+#include "../../include/algorithm/StdSort.hpp"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+// libstdc++ implements the parallel policies on top of TBB, so they are opt-in to keep the link dependency explicit
+#if defined(RAYSTRUCT_PARALLEL_STL) && __has_include(<execution>)
+#include <execution>
+#if defined(__cpp_lib_execution) || defined(__cpp_lib_parallel_algorithm)
+#define RAYSTRUCT_HAS_PAR_UNSEQ 1
+#endif
+#endif
+
+// Namespace for internal linkage
+namespace {
+// Runs the selected standard library sort on the vector.
+void runVariant(std::vector<int>& elements, StdSort::Variant variant) {
+    switch (variant) {
+        case StdSort::Variant::STABLE_SORT:
+            std::stable_sort(elements.begin(), elements.end());
+            return;
+        case StdSort::Variant::PARALLEL_SORT:
+#ifdef RAYSTRUCT_HAS_PAR_UNSEQ
+            std::sort(std::execution::par_unseq, elements.begin(), elements.end());
+            return;
+#else
+            [[fallthrough]];
+#endif
+        case StdSort::Variant::SORT:
+        default:
+            std::sort(elements.begin(), elements.end());
+            return;
+    }
+}
+} // namespace
+
+// Prints the array on a single line.
+void StdSort::display(const std::vector<int>& elements) {
+    for (const int& val : elements) {
+        std::cout << val << " ";
+    }
+    std::cout << std::endl;
+}
+
+// Baseline run used as the reference point for every other sort.
+void StdSort::execute(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+    runVariant(elements, variant);
+}
+
+// The standard algorithms are opaque, so only the before/after states are shown.
+void StdSort::executeAndDisplay(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+
+    display(elements);
+    runVariant(elements, variant);
+    display(elements);
+}
+
+// Returns the wrapped call; the parallel variant says so when it fell back to std::sort.
+std::string StdSort::getName() const {
+    switch (variant) {
+        case Variant::STABLE_SORT:
+            return "std::stable_sort";
+        case Variant::PARALLEL_SORT:
+            return parallelAvailable() ? "std::sort (par_unseq)" : "std::sort (par_unseq unavailable, sequential)";
+        case Variant::SORT:
+        default:
+            return "std::sort";
+    }
+}
+
+// Stores the selected standard library call.
+void StdSort::setVariant(Variant choice) {
+    variant = choice;
+}
+
+// True when the build enabled the parallel standard library algorithms.
+bool StdSort::parallelAvailable() {
+#ifdef RAYSTRUCT_HAS_PAR_UNSEQ
+    return true;
+#else
+    return false;
+#endif
+}
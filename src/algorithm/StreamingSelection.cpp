@@ -0,0 +1,279 @@
+// src/algorithm/StreamingSelection.cpp
+#include "../../include/algorithm/StreamingSelection.hpp"
+#include "../../include/algorithm/SimdKernels.hpp"
+#include "../../include/algorithm/SplitMix64.hpp"
+#include "../../include/algorithm/TopKBuffer.hpp"
+#include "../../include/core/WorkStealingThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// Namespace for internal linkage
+namespace {
+// Chunked view of a stream. Chunks are addressed by index so threads can claim them independently;
+// each thread gets its own reader so no state is shared while reading.
+class ChunkReader {
+public:
+    virtual ~ChunkReader() = default;
+    // Fills out with chunk index and returns how many elements it holds.
+    virtual std::size_t read(std::size_t chunk, int* out) = 0;
+};
+
+// Reads a slice of an in-memory vector.
+class VectorReader : public ChunkReader {
+private:
+    const std::vector<int>& elements;
+    std::size_t chunkElements;
+
+public:
+    VectorReader(const std::vector<int>& elements, std::size_t chunkElements)
+        : elements(elements), chunkElements(chunkElements) {}
+
+    // Copies the slice, matching what a file read would cost per chunk.
+    std::size_t read(std::size_t chunk, int* out) override {
+        const std::size_t begin = std::min(elements.size(), chunk * chunkElements);
+        const std::size_t end = std::min(elements.size(), begin + chunkElements);
+        std::copy(elements.begin() + begin, elements.begin() + end, out);
+        return end - begin;
+    }
+};
+
+// Reads a chunk of a binary int32 file through this thread's own stream.
+class FileReader : public ChunkReader {
+private:
+    std::ifstream file;
+    std::size_t chunkElements;
+
+public:
+    FileReader(const std::string& path, std::size_t chunkElements)
+        : file(path, std::ios::binary), chunkElements(chunkElements) {}
+
+    // Seeks to the chunk and reads as much of it as the file holds.
+    std::size_t read(std::size_t chunk, int* out) override {
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(chunk * chunkElements * sizeof(int)));
+        file.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(chunkElements * sizeof(int)));
+        return static_cast<std::size_t>(file.gcount()) / sizeof(int);
+    }
+};
+
+// Generates chunk i from (seed, i), so any thread can produce any chunk.
+class GeneratorReader : public ChunkReader {
+private:
+    std::size_t total;
+    std::uint64_t seed;
+    std::size_t chunkElements;
+
+public:
+    GeneratorReader(std::size_t total, std::uint64_t seed, std::size_t chunkElements)
+        : total(total), seed(seed), chunkElements(chunkElements) {}
+
+    // Fills the chunk with 32-bit values from a per-chunk SplitMix64 sequence.
+    std::size_t read(std::size_t chunk, int* out) override {
+        const std::size_t begin = std::min(total, chunk * chunkElements);
+        const std::size_t count = std::min(total, begin + chunkElements) - begin;
+        std::uint64_t state = seed ^ (static_cast<std::uint64_t>(chunk) * 0xD1B54A32D192ED03ull);
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<int>(static_cast<std::uint32_t>(splitMix64(state) >> 32));
+        }
+        return count;
+    }
+};
+
+// Length of a binary int32 file in elements, or 0 when it cannot be opened.
+std::size_t fileElements(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return 0;
+    }
+    return static_cast<std::size_t>(file.tellg()) / sizeof(int);
+}
+} // namespace
+
+// Starts with the widest instruction set available on this machine.
+StreamingSelection::StreamingSelection() : level(SimdKernels::detectLevel()) {}
+
+// Claims chunks from a shared counter; every task owns a reader, a chunk buffer and a top-k buffer,
+// so memory stays at threads * (chunk + k) no matter how long the stream is.
+void StreamingSelection::stream(DataStructure* ds) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<int> structureElements;
+    std::size_t total = 0;
+    switch (source) {
+        case Source::FILE:
+            total = fileElements(filePath);
+            break;
+        case Source::GENERATOR:
+            total = generatorCount;
+            break;
+        case Source::STRUCTURE:
+        default:
+            structureElements = ds->getElements();
+            total = structureElements.size();
+            break;
+    }
+
+    const std::size_t wanted = static_cast<std::size_t>(k);
+    lastRunValid = k > 0 && wanted <= total;
+    if (!lastRunValid) {
+        std::cerr << "Stream holds " << total << " elements; k must be between 1 and " << total << "." << std::endl;
+        result = 0;
+        elementsStreamed = 0;
+        lastSeconds = 0.0;
+        threadsUsed = 0;
+        return;
+    }
+
+    const std::size_t chunks = (total + chunkElements - 1) / chunkElements;
+    const unsigned threads = static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(threadCount, chunks)));
+    threadsUsed = threads;
+    std::atomic<std::size_t> nextChunk{0};
+    std::vector<std::unique_ptr<TopKBuffer>> buffers(threads);
+    std::vector<std::size_t> consumed(threads, 0);
+
+    auto worker = [&](unsigned t) {
+        std::unique_ptr<ChunkReader> reader;
+        if (source == Source::FILE) {
+            reader = std::make_unique<FileReader>(filePath, chunkElements);
+        } else if (source == Source::GENERATOR) {
+            reader = std::make_unique<GeneratorReader>(generatorCount, generatorSeed, chunkElements);
+        } else {
+            reader = std::make_unique<VectorReader>(structureElements, chunkElements);
+        }
+
+        buffers[t] = std::make_unique<TopKBuffer>(wanted, !isSmallest, level);
+        std::vector<int> chunk(chunkElements);
+        for (std::size_t c = nextChunk++; c < chunks; c = nextChunk++) {
+            std::size_t count = reader->read(c, chunk.data());
+            buffers[t]->offer(chunk.data(), count);
+            consumed[t] += count;
+        }
+    };
+
+    WorkStealingThreadPool::poolFor(context).runTasks(threads, worker);
+
+    // Final merge: the k best overall are among the union of each thread's k best
+    elementsStreamed = consumed[0];
+    for (unsigned t = 1; t < threads; ++t) {
+        buffers[0]->merge(*buffers[t]);
+        elementsStreamed += consumed[t];
+    }
+
+    lastRunValid = buffers[0]->full();
+    result = lastRunValid ? buffers[0]->threshold() : 0;
+    auto end = std::chrono::high_resolution_clock::now();
+    lastSeconds = std::chrono::duration<double>(end - start).count();
+}
+
+// Used only through SelectionAlgorithm's interface: wraps the vector as a structure-sourced stream.
+int StreamingSelection::select(std::vector<int>& elements) {
+    TopKBuffer buffer(static_cast<std::size_t>(k), !isSmallest, level);
+    for (std::size_t begin = 0; begin < elements.size(); begin += chunkElements) {
+        buffer.offer(elements.data() + begin, std::min(chunkElements, elements.size() - begin));
+    }
+    return buffer.full() ? buffer.threshold() : 0;
+}
+
+// Prints the statistic followed by the stream statistics.
+void StreamingSelection::display(const std::vector<int>& elements) {
+    if (!lastRunValid) {
+        std::cout << "No result: the stream is shorter than k." << std::endl;
+        return;
+    }
+
+    SelectionAlgorithm::display(elements);
+    std::cout << "Streamed " << elementsStreamed << " elements in " << lastSeconds * 1000.0 << "ms ("
+              << getThroughput() / 1e6 << " M elements/s, " << threadsUsed << " thread(s), "
+              << chunkElements << " elements per chunk)" << std::endl;
+}
+
+// Streams the configured source silently.
+void StreamingSelection::execute(DataStructure* ds) {
+    stream(ds);
+}
+
+// Streams the configured source, then prints the result and throughput.
+void StreamingSelection::executeAndDisplay(DataStructure* ds) {
+    stream(ds);
+    display({});
+}
+
+// Returns the algorithm's name with its configuration.
+std::string StreamingSelection::getName() const {
+    std::string name = "Streaming Selection (";
+    switch (source) {
+        case Source::FILE:
+            name += "file " + filePath;
+            break;
+        case Source::GENERATOR:
+            name += std::to_string(generatorCount) + " generated";
+            break;
+        case Source::STRUCTURE:
+        default:
+            name += "structure";
+            break;
+    }
+    name += ", " + std::to_string(chunkElements) + "-element chunks";
+    if (threadCount > 1) {
+        name += ", " + std::to_string(threadCount) + " threads";
+    }
+    return name + ")";
+}
+
+// Chunks can be consumed by several pool tasks.
+bool StreamingSelection::isParallel() const {
+    return true;
+}
+
+// Getter for the task count.
+unsigned StreamingSelection::getThreadCount() const {
+    return threadCount;
+}
+
+// Streams the benchmarked structure.
+void StreamingSelection::useStructure() {
+    source = Source::STRUCTURE;
+}
+
+// Streams a binary file of 32-bit integers.
+void StreamingSelection::setFile(const std::string& path) {
+    source = Source::FILE;
+    filePath = path;
+}
+
+// Streams generated integers.
+void StreamingSelection::setGenerator(std::size_t count, std::uint64_t seed) {
+    source = Source::GENERATOR;
+    generatorCount = count;
+    generatorSeed = seed;
+}
+
+// Stores the chunk size (at least one element).
+void StreamingSelection::setChunkElements(std::size_t elements) {
+    chunkElements = std::max<std::size_t>(1, elements);
+}
+
+// Stores the requested number of threads (at least one).
+void StreamingSelection::setThreadCount(unsigned threads) {
+    threadCount = std::max(1u, threads);
+}
+
+// Getter for the element count of the last run.
+std::size_t StreamingSelection::getElementsStreamed() const {
+    return elementsStreamed;
+}
+
+// Elements per second of the last run (0 before the first run).
+double StreamingSelection::getThroughput() const {
+    return lastSeconds > 0.0 ? static_cast<double>(elementsStreamed) / lastSeconds : 0.0;
+}
+
+// Getter for the thread count of the last run (0 before the first run).
+unsigned StreamingSelection::getThreadsUsed() const {
+    return threadsUsed;
+}
@@ -0,0 +1,93 @@
+// src/algorithm/TopKBuffer.cpp
+#include "../../include/algorithm/TopKBuffer.hpp"
+#include "../../include/algorithm/SimdKernels.hpp"
+#include <algorithm>
+
+// Namespace for internal linkage
+namespace {
+// Keys filtered per block; 16 KiB of keys plus the candidate buffer stay in L1.
+constexpr std::size_t kFilterBlock = 4096;
+} // namespace
+
+// Reserves the heap and the filter output up front so offer() never allocates.
+TopKBuffer::TopKBuffer(std::size_t k, bool keepLargest, SimdLevel level)
+    : capacity(k), keepLargest(keepLargest), level(SimdKernels::clampLevel(level)), candidates(kFilterBlock + 8) {
+    heap.reserve(k);
+}
+
+// Direction is fixed per buffer, so this branch is perfectly predicted.
+bool TopKBuffer::better(int a, int b) const {
+    return keepLargest ? a > b : a < b;
+}
+
+// Pops the worst key and pushes the new one in its place.
+void TopKBuffer::replaceWorst(int value) {
+    auto cmp = [this](int a, int b) { return better(a, b); };
+    std::pop_heap(heap.begin(), heap.end(), cmp);
+    heap.back() = value;
+    std::push_heap(heap.begin(), heap.end(), cmp);
+}
+
+// Fills the heap first, then filters block by block against the current threshold. Each block's
+// survivors are sorted best-first so insertion stops at the first one that no longer qualifies.
+void TopKBuffer::offer(const int* data, std::size_t n) {
+    if (capacity == 0) {
+        return;
+    }
+
+    auto cmp = [this](int a, int b) { return better(a, b); };
+    std::size_t i = 0;
+    if (heap.size() < capacity) {
+        std::size_t take = std::min(capacity - heap.size(), n);
+        heap.insert(heap.end(), data, data + take);
+        i = take;
+        if (heap.size() == capacity) {
+            std::make_heap(heap.begin(), heap.end(), cmp);
+        }
+    }
+
+    while (i < n) {
+        const std::size_t length = std::min(kFilterBlock, n - i);
+        std::size_t found = SimdKernels::filter(data + i, length, heap.front(), keepLargest, candidates.data(), level);
+        i += length;
+        if (found == 0) {
+            continue;
+        }
+
+        std::sort(candidates.begin(), candidates.begin() + found, cmp);
+        for (std::size_t c = 0; c < found && better(candidates[c], heap.front()); ++c) {
+            replaceWorst(candidates[c]);
+        }
+    }
+}
+
+// Another buffer's keys are just more input.
+void TopKBuffer::merge(const TopKBuffer& other) {
+    offer(other.heap.data(), other.heap.size());
+}
+
+// Returns how many keys are kept.
+std::size_t TopKBuffer::size() const {
+    return heap.size();
+}
+
+// Reports whether k keys have been seen.
+bool TopKBuffer::full() const {
+    return heap.size() == capacity;
+}
+
+// Until the heap is full it is unordered, so the worst key is searched for.
+int TopKBuffer::threshold() const {
+    if (!full()) {
+        auto cmp = [this](int a, int b) { return better(a, b); };
+        return *std::max_element(heap.begin(), heap.end(), cmp);
+    }
+    return heap.front();
+}
+
+// Copies the kept keys and sorts them best first.
+std::vector<int> TopKBuffer::sortedBest() const {
+    std::vector<int> best = heap;
+    std::sort(best.begin(), best.end(), [this](int a, int b) { return better(a, b); });
+    return best;
+}
@@ -0,0 +1,250 @@
+// src/core/WorkStealingThreadPool.cpp
+#include "../../include/core/WorkStealingThreadPool.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Namespace for internal linkage
+namespace {
+// Pool and queue index of the current thread; null outside every pool's workers.
+thread_local const WorkStealingThreadPool* currentPool = nullptr;
+thread_local std::size_t currentQueue = 0;
+// Empty polls wait() makes before it blocks; enough to cover short tasks without a futex round trip.
+constexpr unsigned kWaitSpins = 64;
+
+// Reads an unsigned environment variable, falling back when it is unset or not a positive number.
+unsigned environmentUnsigned(const char* name, unsigned fallback) {
+    const char* value = std::getenv(name);
+    if (!value) {
+        return fallback;
+    }
+    try {
+        const long parsed = std::stol(value);
+        return parsed > 0 ? static_cast<unsigned>(parsed) : fallback;
+    } catch (const std::exception&) {
+        return fallback;
+    }
+}
+
+// Pins a thread to one CPU; a no-op where affinity is not supported.
+void pinToCpu(std::thread& thread, unsigned cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+    (void)thread;
+    (void)cpu;
+#endif
+}
+} // namespace
+
+// Starts the workers right away so no thread is created inside a timed region.
+WorkStealingThreadPool::WorkStealingThreadPool(unsigned threadCount, bool pinThreads)
+    : threads(std::max(1u, threadCount)), pinned(pinThreads) {
+    start();
+}
+
+// Joins the workers.
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+    stop();
+}
+
+// One deque per worker plus the injection queue. Workers are pinned round-robin to CPUs 1, 2, ... (or
+// entries 1, 2, ... of the CPU list) and never wrap onto the first one, which belongs to the waiting
+// thread; only a single-CPU list has nowhere else to put them.
+void WorkStealingThreadPool::start() {
+    stopping = false;
+    queues.clear();
+    for (unsigned q = 0; q < threads; ++q) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    const unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned w = 0; w + 1 < threads; ++w) {
+        workers.emplace_back(&WorkStealingThreadPool::workerLoop, this, static_cast<std::size_t>(w));
+        if (pinned) {
+            const std::size_t available = cpuList.empty() ? cpus : cpuList.size();
+            const std::size_t slot = available > 1 ? 1 + w % (available - 1) : 0;
+            pinToCpu(workers.back(), cpuList.empty() ? static_cast<unsigned>(slot) : cpuList[slot]);
+        }
+    }
+}
+
+// Wakes every worker so it sees the stop flag, then joins them.
+void WorkStealingThreadPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    sleepCondition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+// Sleeps only while nothing is queued; submit() bumps the counter before taking the sleep mutex,
+// so a wakeup cannot be lost between the check and the wait.
+void WorkStealingThreadPool::workerLoop(std::size_t index) {
+    currentPool = this;
+    currentQueue = index;
+
+    Task task;
+    while (!stopping) {
+        if (findTask(index, task)) {
+            runTask(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCondition.wait(lock, [this]() { return stopping || queued.load() > 0; });
+    }
+}
+
+// Own deque from the back, then other deques from the front, starting after our own index.
+bool WorkStealingThreadPool::findTask(std::size_t index, Task& task) {
+    if (queued.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+
+    {
+        WorkerQueue& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            --queued;
+            return true;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+        WorkerQueue& victim = *queues[(index + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            --queued;
+            return true;
+        }
+    }
+    return false;
+}
+
+// The group may be destroyed as soon as pending reaches zero, so that is the last access.
+void WorkStealingThreadPool::runTask(Task& task) {
+    TaskGroup* group = task.group;
+    try {
+        task.run();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(group->errorMutex);
+        if (!group->error) {
+            group->error = std::current_exception();
+        }
+    }
+    task.run = nullptr;
+    if (group->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // Taking the mutex orders this with a waiter's predicate check, so the wakeup cannot be lost
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        doneCondition.notify_all();
+    }
+}
+
+// Workers use their own deque; every other thread shares the injection queue (the last one).
+std::size_t WorkStealingThreadPool::callerQueue() const {
+    return currentPool == this ? currentQueue : queues.size() - 1;
+}
+
+// Getter for the thread count.
+unsigned WorkStealingThreadPool::threadCount() const {
+    return threads;
+}
+
+// The group is counted before the task becomes visible, so wait() cannot see zero too early.
+void WorkStealingThreadPool::submit(TaskGroup& group, std::function<void()> task) {
+    group.pending.fetch_add(1, std::memory_order_relaxed);
+    {
+        WorkerQueue& queue = *queues[callerQueue()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(Task{std::move(task), &group});
+    }
+    queued.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    sleepCondition.notify_one();
+    // Blocked waiters may help with the new task
+    doneCondition.notify_all();
+}
+
+// Helps with any queued work, which keeps nested fork/join deadlock-free. When nothing is left to take,
+// the remaining tasks are running elsewhere: spin briefly for short tasks, then block. Spinning on yield()
+// alone would starve a worker sharing the CPU of a SCHED_FIFO waiter, since yield() never gives way to a
+// lower policy.
+void WorkStealingThreadPool::wait(TaskGroup& group) {
+    const std::size_t index = callerQueue();
+    Task task;
+    unsigned idleSpins = 0;
+    while (group.pending.load(std::memory_order_acquire) > 0) {
+        if (findTask(index, task)) {
+            runTask(task);
+            idleSpins = 0;
+        } else if (++idleSpins < kWaitSpins) {
+            std::this_thread::yield();
+        } else {
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            doneCondition.wait(lock, [&]() { return group.pending.load() == 0 || queued.load() > 0; });
+            idleSpins = 0;
+        }
+    }
+
+    if (group.error) {
+        std::exception_ptr error = group.error;
+        group.error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+// Restarts the workers with the new configuration.
+void WorkStealingThreadPool::configure(unsigned threadCount, bool pinThreads) {
+    stop();
+    threads = std::max(1u, threadCount);
+    pinned = pinThreads;
+    start();
+}
+
+// Restarts with an explicit CPU list, keeping the thread count.
+void WorkStealingThreadPool::pinTo(const std::vector<unsigned>& cpus) {
+    stop();
+    cpuList = cpus;
+    pinned = !cpus.empty();
+    start();
+}
+
+// Getter for the affinity setting.
+bool WorkStealingThreadPool::isPinned() const {
+    return pinned;
+}
+
+// Created on first use and shared by every algorithm in the process.
+WorkStealingThreadPool& WorkStealingThreadPool::shared() {
+    static WorkStealingThreadPool pool(
+        environmentUnsigned("RAYSTRUCT_THREADS", std::max(1u, std::thread::hardware_concurrency())),
+        environmentUnsigned("RAYSTRUCT_PIN_THREADS", 0) == 1);
+    return pool;
+}
+
+// Prefers the pool the benchmark handed over.
+ThreadPool& WorkStealingThreadPool::poolFor(const ExecutionContext* context) {
+    if (context && context->pool) {
+        return *context->pool;
+    }
+    return shared();
+}
@@ -1,7 +1,17 @@
 // src/main.cpp
 #include <cstdlib>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
 #include "../include/manager/InputManager.hpp"
 #include "../include/manager/BenchmarkManager.hpp"
+#include "../include/manager/BenchmarkScheduler.hpp"
+#include "../include/manager/PgoPipeline.hpp"
+#include "../include/manager/PluginMatrix.hpp"
+#include "../include/manager/PluginSweep.hpp"
+#include "../include/manager/PluginWatcher.hpp"
+#include "../include/structure/ListStructure.hpp"
 
 // Clears the terminal so repeated runs start with a clean header.
 void clearConsole() {
@@ -12,6 +22,74 @@ void clearConsole() {
 #endif
 }
 
+// Asks a yes/no question and reads the whole answer line; only "y" counts as yes, and so does nothing at EOF.
+bool promptYesNo(const std::string& question) {
+    std::cout << "\n" << question << " (y/n)" << std::endl;
+    std::cout << ">>> ";
+    std::string answer;
+    std::getline(std::cin >> std::ws, answer);
+    return answer == "y";
+}
+
+// Reads whole lines until one holds an integer in [minimum, maximum]; returns minimum at EOF.
+long promptLong(const std::string& prompt, long minimum, long maximum, const std::string& outOfRange) {
+    while (true) {
+        std::cout << "\n" << prompt << std::endl;
+        std::cout << ">>> ";
+        std::string answer;
+        if (!std::getline(std::cin >> std::ws, answer)) {
+            return minimum;
+        }
+
+        long value = 0;
+        try {
+            value = std::stol(answer);
+        } catch (const std::exception&) {
+            std::cout << "\nInvalid input. Please enter an integer." << std::endl;
+            continue;
+        }
+        if (value < minimum || value > maximum) {
+            std::cout << "\n" << outOfRange << std::endl;
+            continue;
+        }
+        return value;
+    }
+}
+
+// Counts, sizes and thread numbers: at least 1.
+long promptPositiveLong(const std::string& prompt, const std::string& belowOne) {
+    return promptLong(prompt, 1, std::numeric_limits<long>::max(), belowOne);
+}
+
+// Offers to spread a batch over the cores, then whole L3 domains per run when there are several; false
+// leaves the batch to run one benchmark after another.
+bool promptConcurrentBatch(BenchmarkScheduler& scheduler, const BenchmarkOptions& options, const std::string& what) {
+    scheduler.setOptions(options);
+    const std::size_t coreSlots = scheduler.slots().size();
+    if (coreSlots < 2 || !promptYesNo("Run the " + what + " concurrently, one per core on " + std::to_string(coreSlots) + " cores?")) {
+        return false;
+    }
+
+    scheduler.setGranularity(SlotGranularity::L3);
+    const std::size_t domainSlots = scheduler.slots().size();
+    if (domainSlots < 2 ||
+        !promptYesNo("Give each run a whole L3 domain instead (" + std::to_string(domainSlots) + " slots, for parallel algorithms)?")) {
+        scheduler.setGranularity(SlotGranularity::CORE);
+    }
+    return true;
+}
+
+// Loads the session's plugin again after a tool unloaded it; reports the failure instead of leaving the
+// session without an algorithm unnoticed.
+Algorithm* reloadSessionAlgorithm(const InputManager& inputManager, const InputManager::AlgorithmSelection& selection) {
+    Algorithm* reloaded = inputManager.createAlgorithm(selection);
+    if (!reloaded) {
+        std::cout << "\nCould not load " << selection.customAlgorithmLibraryPath
+                  << " again; select the algorithm once more to keep benchmarking it." << std::endl;
+    }
+    return reloaded;
+}
+
 // The main method that coordinates structure/algorithm selection, parameter prompts, and benchmarking.
 int main() {
     bool shouldExit = false;
@@ -105,7 +183,45 @@ int main() {
                         std::cout << "\nInvalid option. Please enter 'min' or 'max'.\n";
                     }
                 }
-            } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::HEAP_SELECTION) {
+
+                std::string engine;
+                auto* heapBuild = dynamic_cast<HeapBuild*>(algo);
+
+                while (true) {
+                    std::cout << "\nSelect build engine (recursive/iterative/bottom-up/4-ary/8-ary/compare)" << std::endl;
+                    std::cout << ">>> ";
+                    std::cin >> engine;
+                    // Ignore remaining input to avoid issues
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+                    if (engine == "recursive") {
+                        heapBuild->setEngine(HeapBuild::Engine::RECURSIVE);
+                        break;
+                    } else if (engine == "iterative") {
+                        heapBuild->setEngine(HeapBuild::Engine::ITERATIVE);
+                        break;
+                    } else if (engine == "bottom-up") {
+                        heapBuild->setEngine(HeapBuild::Engine::BOTTOM_UP);
+                        break;
+                    } else if (engine == "4-ary") {
+                        heapBuild->setEngine(HeapBuild::Engine::QUATERNARY);
+                        break;
+                    } else if (engine == "8-ary") {
+                        heapBuild->setEngine(HeapBuild::Engine::OCTONARY);
+                        break;
+                    } else if (engine == "compare") {
+                        // Print the engine table, then benchmark the recursive baseline as usual
+                        heapBuild->compareEngines(ds);
+                        break;
+                    } else {
+                        std::cout << "\nInvalid option. Please enter 'recursive', 'iterative', 'bottom-up', '4-ary', '8-ary' or 'compare'.\n";
+                    }
+                }
+            } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::HEAP_SELECTION ||
+                       algorithmSelection.selectedAlgorithm == AlgorithmEnum::QUICK_SELECT ||
+                       algorithmSelection.selectedAlgorithm == AlgorithmEnum::SIMD_SELECTION ||
+                       algorithmSelection.selectedAlgorithm == AlgorithmEnum::STREAMING_SELECTION ||
+                       algorithmSelection.selectedAlgorithm == AlgorithmEnum::PARALLEL_SELECTION) {
                 std::string choice;
                 std::string tmp;
                 int k;
@@ -138,18 +254,308 @@ int main() {
                     // Ignore remaining input to avoid issues
                     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
-                    HeapSelection* heapSelect = dynamic_cast<HeapSelection*>(algo);
+                    auto* selection = dynamic_cast<SelectionAlgorithm*>(algo);
 
-                    if (k <= 0 || k > (int)ds->getElements().size()) {
+                    // A streamed file or generator can be longer than the structure; its length is checked when it runs
+                    bool streaming = algorithmSelection.selectedAlgorithm == AlgorithmEnum::STREAMING_SELECTION;
+                    if (k <= 0 || (!streaming && k > (int)ds->getElements().size())) {
                         std::cout << "Invalid k: must be between 1 and " << ds->getElements().size() << std::endl;
                         continue;
                     }
 
-                    heapSelect->setK(k);
-                    heapSelect->setIsSmallest(isSmallest);
+                    selection->setK(k);
+                    selection->setIsSmallest(isSmallest);
                     break;
                     
                 }
+
+                if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::QUICK_SELECT) {
+                    std::string method;
+                    auto* quickSelect = dynamic_cast<QuickSelect*>(algo);
+
+                    while (true) {
+                        std::cout << "\nSelect method (introselect/floyd-rivest/nth_element)" << std::endl;
+                        std::cout << ">>> ";
+                        std::cin >> method;
+                        // Ignore remaining input to avoid issues
+                        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+                        if (method == "introselect") {
+                            quickSelect->setMethod(QuickSelect::Method::INTROSELECT);
+                            break;
+                        } else if (method == "floyd-rivest") {
+                            quickSelect->setMethod(QuickSelect::Method::FLOYD_RIVEST);
+                            break;
+                        } else if (method == "nth_element") {
+                            quickSelect->setMethod(QuickSelect::Method::NTH_ELEMENT);
+                            break;
+                        } else {
+                            std::cout << "\nInvalid option. Please enter 'introselect', 'floyd-rivest' or 'nth_element'.\n";
+                        }
+                    }
+                } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::SIMD_SELECTION) {
+                    std::string mode;
+                    auto* simdSelection = dynamic_cast<SimdSelection*>(algo);
+
+                    while (true) {
+                        std::cout << "\nSelect mode (quickselect/top-k)" << std::endl;
+                        std::cout << ">>> ";
+                        std::cin >> mode;
+                        // Ignore remaining input to avoid issues
+                        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+                        if (mode == "quickselect") {
+                            simdSelection->setMode(SimdSelection::Mode::QUICKSELECT);
+                            break;
+                        } else if (mode == "top-k") {
+                            simdSelection->setMode(SimdSelection::Mode::TOP_K);
+                            break;
+                        } else {
+                            std::cout << "\nInvalid option. Please enter 'quickselect' or 'top-k'.\n";
+                        }
+                    }
+                } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::STREAMING_SELECTION) {
+                    std::string input;
+                    auto* streamingSelection = dynamic_cast<StreamingSelection*>(algo);
+
+                    while (true) {
+                        std::cout << "\nSelect input source (structure/file/generator)" << std::endl;
+                        std::cout << ">>> ";
+                        std::cin >> input;
+
+                        if (input == "structure") {
+                            streamingSelection->useStructure();
+                            break;
+                        } else if (input == "file") {
+                            std::cout << "\nEnter path to a binary file of 32-bit integers" << std::endl;
+                            std::cout << ">>> ";
+                            std::cin >> input;
+                            streamingSelection->setFile(input);
+                            break;
+                        } else if (input == "generator") {
+                            const long count = promptPositiveLong("Enter number of elements to generate", "Element count must be at least 1.");
+                            streamingSelection->setGenerator(static_cast<std::size_t>(count), 1);
+                            break;
+                        } else {
+                            std::cout << "\nInvalid option. Please enter 'structure', 'file' or 'generator'.\n";
+                        }
+                    }
+
+                    streamingSelection->setChunkElements(static_cast<std::size_t>(
+                        promptPositiveLong("Enter chunk size in elements", "Chunk size must be at least 1.")));
+                    streamingSelection->setThreadCount(static_cast<unsigned>(
+                        promptPositiveLong("Enter thread count (1 reads chunks on the calling thread)", "Thread count must be at least 1.")));
+                } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::PARALLEL_SELECTION) {
+                    std::string input;
+                    auto* parallelSelection = dynamic_cast<ParallelSelection*>(algo);
+
+                    while (true) {
+                        std::cout << "\nSelect strategy (auto/heaps/sampling)" << std::endl;
+                        std::cout << ">>> ";
+                        std::cin >> input;
+
+                        if (input == "auto") {
+                            parallelSelection->setStrategy(ParallelSelection::Strategy::AUTO);
+                            break;
+                        } else if (input == "heaps") {
+                            parallelSelection->setStrategy(ParallelSelection::Strategy::LOCAL_HEAPS);
+                            break;
+                        } else if (input == "sampling") {
+                            parallelSelection->setStrategy(ParallelSelection::Strategy::SAMPLE_PIVOTS);
+                            break;
+                        } else {
+                            std::cout << "\nInvalid option. Please enter 'auto', 'heaps' or 'sampling'.\n";
+                        }
+                    }
+
+                    parallelSelection->setThreadCount(static_cast<unsigned>(
+                        promptPositiveLong("Enter thread count (the scaling report doubles up to it)", "Thread count must be at least 1.")));
+                }
+            } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::INSERTION_SORT) {
+                std::string tmp;
+                auto* insertionSort = dynamic_cast<InsertionSort*>(algo);
+
+                while (true) {
+                    std::cout << "\nSelect insertion kernel (linear/binary/branchless/network)" << std::endl;
+                    std::cout << ">>> ";
+                    std::cin >> tmp;
+
+                    if (tmp == "linear") {
+                        insertionSort->setVariant(InsertionSort::Variant::LINEAR);
+                        break;
+                    } else if (tmp == "binary") {
+                        insertionSort->setVariant(InsertionSort::Variant::BINARY);
+                        break;
+                    } else if (tmp == "branchless") {
+                        insertionSort->setVariant(InsertionSort::Variant::BRANCHLESS);
+                        break;
+                    } else if (tmp == "network") {
+                        insertionSort->setVariant(InsertionSort::Variant::NETWORK);
+                        break;
+                    } else {
+                        std::cout << "\nInvalid option. Please enter 'linear', 'binary', 'branchless' or 'network'.\n";
+                    }
+                }
+
+                insertionSort->setRepetitions(static_cast<std::size_t>(
+                    promptPositiveLong("Enter repetitions per benchmark (1 for a single sort)", "Repetitions must be at least 1.")));
+            } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::RADIX_SORT) {
+                std::string tmp;
+                auto* radixSort = dynamic_cast<LsdRadixSort*>(algo);
+
+                while (true) {
+                    std::cout << "\nSelect digit width in bits (8/11)" << std::endl;
+                    std::cout << ">>> ";
+                    std::cin >> tmp;
+
+                    if (tmp == "8" || tmp == "11") {
+                        radixSort->setDigitBits(std::stoi(tmp));
+                        break;
+                    }
+                    std::cout << "\nInvalid option. Please enter '8' or '11'.\n";
+                }
+
+                radixSort->setThreadCount(static_cast<unsigned>(
+                    promptPositiveLong("Enter thread count (1 for the serial kernel)", "Thread count must be at least 1.")));
+            } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::STD_SORT) {
+                std::string variant;
+                auto* stdSort = dynamic_cast<StdSort*>(algo);
+
+                while (true) {
+                    std::cout << "\nSelect standard library call (sort/stable/parallel)" << std::endl;
+                    std::cout << ">>> ";
+                    std::cin >> variant;
+                    // Ignore remaining input to avoid issues
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+                    if (variant == "sort") {
+                        stdSort->setVariant(StdSort::Variant::SORT);
+                        break;
+                    } else if (variant == "stable") {
+                        stdSort->setVariant(StdSort::Variant::STABLE_SORT);
+                        break;
+                    } else if (variant == "parallel") {
+                        if (!StdSort::parallelAvailable()) {
+                            std::cout << "\nParallel STL was not compiled in; falling back to sequential std::sort." << std::endl;
+                        }
+                        stdSort->setVariant(StdSort::Variant::PARALLEL_SORT);
+                        break;
+                    } else {
+                        std::cout << "\nInvalid option. Please enter 'sort', 'stable' or 'parallel'.\n";
+                    }
+                }
+            } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::SORTING_NETWORK) {
+                auto* networkSort = dynamic_cast<SortingNetworkSort*>(algo);
+                const long maxWidth = static_cast<long>(SortingNetworks::kMaxSize);
+                networkSort->setWidth(static_cast<std::size_t>(
+                    promptLong("Enter block width (2-" + std::to_string(maxWidth) + " elements per independent sort)", 2, maxWidth,
+                               "Width must be between 2 and " + std::to_string(maxWidth) + ".")));
+                networkSort->setUseSimd(promptYesNo("Sort eight blocks per AVX2 register?"));
+            } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::MERGE_SORT) {
+                std::string tmp;
+                bool multiway = false;
+                auto* mergeSort = dynamic_cast<MergeSort*>(algo);
+
+                while (true) {
+                    std::cout << "\nSelect merge variant (two-way/multiway)" << std::endl;
+                    std::cout << ">>> ";
+                    std::cin >> tmp;
+
+                    if (tmp == "two-way") {
+                        mergeSort->setVariant(MergeSort::Variant::TWO_WAY);
+                        break;
+                    } else if (tmp == "multiway") {
+                        mergeSort->setVariant(MergeSort::Variant::MULTIWAY);
+                        multiway = true;
+                        break;
+                    } else {
+                        std::cout << "\nInvalid option. Please enter 'two-way' or 'multiway'.\n";
+                    }
+                }
+
+                while (multiway) {
+                    std::cout << "\nEnter merge fan-in (runs merged per loser-tree pass, at least 2)" << std::endl;
+                    std::cout << ">>> ";
+                    std::cin >> tmp;
+
+                    int ways = 0;
+                    try {
+                        ways = std::stoi(tmp);
+                    } catch (const std::exception&) {
+                        std::cout << "\nInvalid input. Please enter an integer." << std::endl;
+                        continue;
+                    }
+                    if (ways < 2) {
+                        std::cout << "\nFan-in must be at least 2." << std::endl;
+                        continue;
+                    }
+
+                    mergeSort->setWays(static_cast<std::size_t>(ways));
+                    break;
+                }
+
+                // Ignore remaining input to avoid issues
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::KWAY_MERGE) {
+                std::string tmp;
+                auto* kWayMerge = dynamic_cast<KWayMerge*>(algo);
+
+                kWayMerge->setWays(static_cast<std::size_t>(promptPositiveLong("Enter number of pre-sorted runs", "Run count must be at least 1.")));
+
+                while (true) {
+                    std::cout << "\nSelect merge engine (loser-tree/heap/pairwise)" << std::endl;
+                    std::cout << ">>> ";
+                    std::cin >> tmp;
+
+                    if (tmp == "loser-tree") {
+                        kWayMerge->setEngine(KWayMerge::Engine::LOSER_TREE);
+                        break;
+                    } else if (tmp == "heap") {
+                        kWayMerge->setEngine(KWayMerge::Engine::HEAP);
+                        break;
+                    } else if (tmp == "pairwise") {
+                        kWayMerge->setEngine(KWayMerge::Engine::PAIRWISE);
+                        break;
+                    } else {
+                        std::cout << "\nInvalid option. Please enter 'loser-tree', 'heap' or 'pairwise'.\n";
+                    }
+                }
+
+                // Ignore remaining input to avoid issues
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::EXTERNAL_MERGE_SORT) {
+                std::string tmp;
+                auto* externalSort = dynamic_cast<ExternalMergeSort*>(algo);
+
+                while (true) {
+                    std::cout << "\nSelect input source (structure/file)" << std::endl;
+                    std::cout << ">>> ";
+                    std::cin >> tmp;
+
+                    if (tmp == "structure") {
+                        externalSort->useStructure();
+                        break;
+                    } else if (tmp == "file") {
+                        std::cout << "\nEnter path to a binary file of 32-bit integers" << std::endl;
+                        std::cout << ">>> ";
+                        std::cin >> tmp;
+                        externalSort->setInputFile(tmp);
+                        break;
+                    } else {
+                        std::cout << "\nInvalid option. Please enter 'structure' or 'file'.\n";
+                    }
+                }
+
+                const long mib = promptPositiveLong("Enter memory budget in MiB", "Memory budget must be at least 1 MiB.");
+                externalSort->setMemoryBudget(static_cast<std::size_t>(mib) << 20);
+
+                std::cout << "\nEnter output path ('none' to discard the sorted output)" << std::endl;
+                std::cout << ">>> ";
+                std::cin >> tmp;
+                externalSort->setOutputFile(tmp == "none" ? std::string() : tmp);
+
+                // Ignore remaining input to avoid issues
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
             } else if (algorithmSelection.selectedAlgorithm == AlgorithmEnum::A_STAR) {
                 auto* graph = dynamic_cast<GraphStructure*>(ds);
                 auto* astarAlgo = dynamic_cast<AStar*>(algo);
@@ -296,11 +702,156 @@ int main() {
                 std::cout << "\n\nBenchmark Successful" << std::endl;
                 std::cout << "Data Structure: " << ds->getName() << std::endl;
                 std::cout << "Algorithm: " << algo->getName() << std::endl;
+
+                // Plugins report the profile they were compiled with, everything else the host build
+                std::string build;
+                if (!algorithmSelection.customAlgorithmBuild.empty()) {
+                    build = "algorithm plugin " + algorithmSelection.customAlgorithmBuild;
+                }
+                if (!structureSelection.customStructureBuild.empty()) {
+                    build += (build.empty() ? "" : "; ") + std::string("structure plugin ") + structureSelection.customStructureBuild;
+                }
+                benchmarkManager.setBuildDescription(build);
                 benchmarkManager.runBenchmark(ds, algo);
             }
 
+            // Parallel algorithms can also be swept over thread counts
+            if (ds && algo && algo->isParallel() && promptYesNo("Run thread-scaling sweep?")) {
+                const long maxThreads = promptPositiveLong("Enter maximum thread count", "Thread count must be at least 1.");
+                benchmarkManager.runScalingSweep(ds, algo, static_cast<unsigned>(maxThreads));
+            }
+
+            // Algorithms over plain integer sequences can be timed on growing random inputs under a time budget;
+            // selections are left out since their k may not fit the smaller inputs
+            if (ds && algo && !dynamic_cast<SelectionAlgorithm*>(algo) && algorithmSelection.selectedAlgorithm != AlgorithmEnum::A_STAR &&
+                algorithmSelection.selectedAlgorithm != AlgorithmEnum::PRIMS &&
+                algorithmSelection.selectedAlgorithm != AlgorithmEnum::EXTERNAL_MERGE_SORT &&
+                algorithmSelection.selectedAlgorithm != AlgorithmEnum::KWAY_MERGE &&
+                promptYesNo("Run input-size sweep on random inputs?")) {
+                const long maxElements = promptPositiveLong("Enter largest input size", "Input size must be at least 1.");
+                const long budgetMs = promptLong("Enter time budget per size in ms (0 for none; stops the algorithm at the first size over it)",
+                                                 0, std::numeric_limits<long>::max(), "Budget cannot be negative.");
+
+                const BenchmarkOptions previous = benchmarkManager.getOptions();
+                if (budgetMs > 0) {
+                    BenchmarkOptions budgeted = previous;
+                    budgeted.timeBudgetMs = static_cast<double>(budgetMs);
+                    benchmarkManager.setOptions(budgeted);
+                }
+                benchmarkManager.runSizeSweep({algo}, BenchmarkManager::sizeSweepSteps(static_cast<std::size_t>(maxElements)));
+                benchmarkManager.setOptions(previous);
+            }
+
+            // Custom algorithms can be rebuilt with profile-guided optimisation and compared
+            if (ds && algo && algorithmSelection.selectedAlgorithm == AlgorithmEnum::CUSTOM &&
+                !algorithmSelection.customAlgorithmPath.empty()) {
+                if (promptYesNo("Compare against a profile-guided (PGO) build trained on a shuffle of this input?")) {
+                    // Same values in another order, so the timed input is not the one the profile came from
+                    std::vector<int> shuffled = ds->getElements();
+                    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(7));
+                    ListStructure training;
+                    for (int value : shuffled) {
+                        training.insert(value);
+                    }
+
+                    // The session's own build leaves the process first and is loaded again afterwards
+                    delete algo;
+                    AlgorithmFactory::unloadCustomLibrary(algorithmSelection.customAlgorithmLibraryPath, true);
+                    PgoPipeline pipeline(inputManager.getPluginCompiler());
+                    pipeline.run(algorithmSelection.customAlgorithmPath, &training, ds, benchmarkManager);
+                    algo = reloadSessionAlgorithm(inputManager, algorithmSelection);
+                }
+
+                if (promptYesNo("Compare compilers and flag sets (g++/clang++ at O2 and O3 + native)?")) {
+                    PluginMatrix matrix;
+                    matrix.addStandardVariants();
+
+                    std::cout << "\nExtra g++ flag sets, separated by '|' (empty for none)" << std::endl;
+                    std::cout << ">>> ";
+                    std::string extra;
+                    std::getline(std::cin, extra);
+
+                    std::stringstream sets(extra);
+                    std::string flags;
+                    while (std::getline(sets, flags, '|')) {
+                        const auto first = flags.find_first_not_of(" \t");
+                        if (first == std::string::npos) continue;
+                        flags = flags.substr(first, flags.find_last_not_of(" \t") - first + 1);
+                        if (!matrix.addVariant(PluginVariant{"g++", BuildProfile::CUSTOM, flags})) {
+                            std::cout << "Skipping flag set with shell metacharacters: " << flags << std::endl;
+                        }
+                    }
+
+                    // A bandwidth-bound kernel would measure its neighbours as much as its flags, so it runs alone
+                    BenchmarkScheduler scheduler;
+                    if (promptConcurrentBatch(scheduler, benchmarkManager.getOptions(), "variants")) {
+                        scheduler.setForceSerial(promptYesNo("Is the algorithm memory-bandwidth bound (time the variants one at a time)?"));
+                        matrix.setScheduler(&scheduler);
+                    }
+                    matrix.run(algorithmSelection.customAlgorithmPath, ds, benchmarkManager);
+                }
+            }
+
+            // A plugin registry can hold many variants; they can all be timed here without recompiling
+            if (ds && algo && algorithmSelection.selectedAlgorithm == AlgorithmEnum::CUSTOM &&
+                !algorithmSelection.customAlgorithmLibraryPath.empty()) {
+                std::vector<RegisteredEntry> algorithms;
+                std::vector<RegisteredEntry> structures;
+                AlgorithmFactory::listCustomAlgorithms(algorithmSelection.customAlgorithmLibraryPath, algorithms);
+                if (!structureSelection.customStructureLibraryPath.empty()) {
+                    DataStructureFactory::listCustomDataStructures(structureSelection.customStructureLibraryPath, structures);
+                }
+
+                if ((algorithms.size() > 1 || structures.size() > 1) &&
+                    promptYesNo("The plugins register " + std::to_string(std::max<std::size_t>(1, algorithms.size())) + " algorithm(s) and " +
+                                std::to_string(std::max<std::size_t>(1, structures.size())) + " structure(s). Sweep all of them?")) {
+                    PluginSweep sweep;
+
+                    // Independent pairs can share the machine, one per core, unless they are bandwidth bound
+                    BenchmarkScheduler scheduler;
+                    if (promptConcurrentBatch(scheduler, benchmarkManager.getOptions(), "pairs")) {
+                        std::cout << "\nRegistered algorithms:";
+                        for (const RegisteredEntry& entry : algorithms) {
+                            std::cout << " " << entry.name << ";";
+                        }
+                        std::cout << "\nMemory-bandwidth bound ones to run alone, separated by ';' (empty for none)" << std::endl;
+                        std::cout << ">>> ";
+                        std::string answer;
+                        std::getline(std::cin, answer);
+
+                        std::vector<std::string> serialNames;
+                        std::stringstream names(answer);
+                        std::string name;
+                        while (std::getline(names, name, ';')) {
+                            const auto first = name.find_first_not_of(" \t");
+                            if (first == std::string::npos) continue;
+                            serialNames.push_back(name.substr(first, name.find_last_not_of(" \t") - first + 1));
+                        }
+                        sweep.setSerialAlgorithms(serialNames);
+                        sweep.setScheduler(&scheduler);
+                    }
+                    sweep.run(algorithmSelection.customAlgorithmLibraryPath, ds, benchmarkManager,
+                              structureSelection.customStructureLibraryPath);
+                }
+            }
+
+            // Watch mode rebuilds and re-times the plugin on every save of its source
+            if (ds && algo && algorithmSelection.selectedAlgorithm == AlgorithmEnum::CUSTOM &&
+                !algorithmSelection.customAlgorithmPath.empty() &&
+                promptYesNo("Watch " + algorithmSelection.customAlgorithmPath + " and re-run this benchmark on every save?")) {
+                // The first watch build is the session's cache entry; unloading it lets every build load fresh
+                delete algo;
+                AlgorithmFactory::unloadCustomLibrary(algorithmSelection.customAlgorithmLibraryPath, true);
+                PluginWatcher watcher(inputManager.getPluginCompiler());
+                watcher.setStopOnEnter(true);
+                watcher.watch(algorithmSelection.customAlgorithmPath, ds, benchmarkManager);
+                algo = reloadSessionAlgorithm(inputManager, algorithmSelection);
+            }
+
             // Display operations or results if applicable
-            if (algorithmSelection.selectedAlgorithm != AlgorithmEnum::HEAP_SELECTION && algorithmSelection.selectedAlgorithm != AlgorithmEnum::A_STAR && algorithmSelection.selectedAlgorithm != AlgorithmEnum::PRIMS) {
+            if (!dynamic_cast<SelectionAlgorithm*>(algo) && algorithmSelection.selectedAlgorithm != AlgorithmEnum::A_STAR && algorithmSelection.selectedAlgorithm != AlgorithmEnum::PRIMS &&
+                algorithmSelection.selectedAlgorithm != AlgorithmEnum::EXTERNAL_MERGE_SORT &&
+                algorithmSelection.selectedAlgorithm != AlgorithmEnum::KWAY_MERGE) {
                 if (ds && algo && ds->getElements().size() <= 10) {
                     std::cout << "\nOperations: " << std::endl;
                     algo->executeAndDisplay(ds);
@@ -1,13 +1,548 @@
 // src/manager/BenchmarkManager.cpp
 #include "../../include/manager/BenchmarkManager.hpp"
+#include "../../include/core/WorkStealingThreadPool.hpp"
+#include "../../include/manager/PluginCompiler.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <thread>
 // OS specific includes
 #if defined(__linux__)
+#include <fcntl.h>
+#include <malloc.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
 #include <unistd.h>
 #elif defined(_WIN32)
 #include <windows.h>
 #include <psapi.h>
 #endif
 
+// Namespace for internal linkage
+namespace {
+// Read-only structure holding the benchmarked elements repeated a number of times, for weak scaling.
+class ReplicatedStructure : public DataStructure {
+private:
+    std::vector<int> elements;
+    std::string name;
+
+public:
+    ReplicatedStructure(const std::vector<int>& base, unsigned copies, const std::string& baseName)
+        : name(baseName + " x" + std::to_string(copies)) {
+        elements.reserve(base.size() * copies);
+        for (unsigned c = 0; c < copies; ++c) {
+            elements.insert(elements.end(), base.begin(), base.end());
+        }
+    }
+
+    // Appends a value.
+    void insert(int value) override {
+        elements.push_back(value);
+    }
+
+    // Removes the first matching value.
+    void remove(int value) override {
+        auto it = std::find(elements.begin(), elements.end(), value);
+        if (it != elements.end()) {
+            elements.erase(it);
+        }
+    }
+
+    // Returns the repeated elements.
+    std::vector<int> getElements() const override {
+        return elements;
+    }
+
+    // Base name with the repeat count.
+    std::string getName() const override {
+        return name;
+    }
+};
+
+// Values put back once a prefaulted run is over. glibc has no call that reads the current M_MMAP_MAX or
+// M_TRIM_THRESHOLD, so these are its documented defaults rather than whatever was in effect before: a
+// program that tuned them itself gets the defaults back. Setting either also turns off glibc's dynamic
+// mmap threshold for the rest of the process.
+constexpr int kDefaultMmapMax = 65536;
+constexpr int kDefaultTrimThreshold = 128 * 1024;
+
+// Applies BenchmarkOptions to the calling thread for its lifetime and undoes them afterwards.
+// Order matters: pinning comes first so prefaulted pages are first touched from the CPU that will
+// use them, and SCHED_FIFO comes last so the setup itself never runs at real-time priority.
+class RunIsolation {
+private:
+#if defined(__linux__)
+    bool restoreAffinity = false;
+    cpu_set_t previousAffinity;
+    bool restoreScheduler = false;
+    int previousPolicy = SCHED_OTHER;
+    sched_param previousParam{};
+    bool restoreLock = false;
+    bool restoreMmapMax = false;
+    bool restoreTrimThreshold = false;
+#endif
+
+    // Prints one line of the isolation report.
+    static void report(const std::string& line) {
+        std::cout << "[Isolation] " << line << "\n";
+    }
+
+public:
+    RunIsolation(const BenchmarkOptions& options, DataStructure* ds) {
+        if (!options.any()) {
+            return;
+        }
+#if defined(__linux__)
+        if (!options.cpus.empty()) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(options.cpus.front(), &set);
+            if (sched_getaffinity(0, sizeof(previousAffinity), &previousAffinity) == 0 &&
+                sched_setaffinity(0, sizeof(set), &set) == 0) {
+                restoreAffinity = true;
+                report("timing thread pinned to CPU " + std::to_string(options.cpus.front()));
+            } else {
+                report("could not pin to CPU " + std::to_string(options.cpus.front()) + " (" + std::strerror(errno) + ")");
+            }
+        }
+
+        if (options.lockMemory) {
+            if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0) {
+                restoreLock = true;
+                report("memory locked with mlockall");
+            } else {
+                report(std::string("mlockall refused (") + std::strerror(errno) + "); check ulimit -l");
+            }
+        }
+
+        if (options.prefault && ds) {
+            // Keep every allocation on the brk heap and never trim it, so the pages touched here are the
+            // ones execute() gets back for its copy of the input and its scratch buffers
+            restoreMmapMax = mallopt(M_MMAP_MAX, 0) == 1;
+            restoreTrimThreshold = mallopt(M_TRIM_THRESHOLD, INT_MAX) == 1;
+
+            std::vector<int> input = ds->getElements();
+            std::vector<int> scratch(input.size() * 2);
+            std::copy(input.begin(), input.end(), scratch.begin());
+            std::copy(input.begin(), input.end(), scratch.begin() + static_cast<std::ptrdiff_t>(input.size()));
+            volatile int sink = scratch.empty() ? 0 : scratch.back();
+            (void)sink;
+            report("prefaulted " + std::to_string(scratch.size() * sizeof(int) / 1024) + " kB");
+        }
+
+        if (options.realtime) {
+            const int minimum = sched_get_priority_min(SCHED_FIFO);
+            const int maximum = sched_get_priority_max(SCHED_FIFO);
+            sched_param param{};
+            param.sched_priority = std::clamp(options.realtimePriority > 0 ? options.realtimePriority : minimum, minimum, maximum);
+            const int previous = pthread_getschedparam(pthread_self(), &previousPolicy, &previousParam);
+            const int status = previous == 0 ? pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) : previous;
+            if (status == 0) {
+                restoreScheduler = true;
+                report("running under SCHED_FIFO priority " + std::to_string(param.sched_priority));
+            } else {
+                report(std::string("SCHED_FIFO refused (") + std::strerror(status) + "); keeping the default policy");
+            }
+        }
+#else
+        (void)ds;
+        report("pinning, SCHED_FIFO, mlockall and prefaulting are only supported on Linux");
+#endif
+    }
+
+    ~RunIsolation() {
+#if defined(__linux__)
+        if (restoreScheduler) {
+            pthread_setschedparam(pthread_self(), previousPolicy, &previousParam);
+        }
+        // Only what the constructor changed is reset, and then to glibc's defaults (see kDefaultMmapMax)
+        if (restoreMmapMax) {
+            mallopt(M_MMAP_MAX, kDefaultMmapMax);
+        }
+        if (restoreTrimThreshold) {
+            mallopt(M_TRIM_THRESHOLD, kDefaultTrimThreshold);
+        }
+        if (restoreLock) {
+            munlockall();
+        }
+        if (restoreAffinity) {
+            sched_setaffinity(0, sizeof(previousAffinity), &previousAffinity);
+        }
+#endif
+    }
+
+    RunIsolation(const RunIsolation&) = delete;
+    RunIsolation& operator=(const RunIsolation&) = delete;
+};
+
+// Discards std::cout output while alive, so repeated runs do not flood the terminal.
+class QuietOutput {
+private:
+    std::ostringstream sink;
+    std::streambuf* previous;
+
+public:
+    QuietOutput() : previous(std::cout.rdbuf(sink.rdbuf())) {}
+    ~QuietOutput() {
+        std::cout.rdbuf(previous);
+    }
+
+    QuietOutput(const QuietOutput&) = delete;
+    QuietOutput& operator=(const QuietOutput&) = delete;
+};
+
+// Hands an algorithm a context for the guard's lifetime, then points it at `after` and restores its
+// thread count, also when prepare() or execute() throws. Without it an exception would leave the
+// algorithm holding a pool that is destroyed with the caller's frame.
+class ContextBinding {
+private:
+    Algorithm* algo;
+    ExecutionContext* after;
+    unsigned threads;
+
+public:
+    ContextBinding(Algorithm* algorithm, ExecutionContext* active, ExecutionContext* restoreTo)
+        : algo(algorithm), after(restoreTo), threads(algorithm->getThreadCount()) {
+        algo->setExecutionContext(active);
+    }
+
+    ~ContextBinding() {
+        algo->setThreadCount(threads);
+        algo->setExecutionContext(after);
+    }
+
+    ContextBinding(const ContextBinding&) = delete;
+    ContextBinding& operator=(const ContextBinding&) = delete;
+};
+
+// Thread counts of a sweep: powers of two below maxThreads, then maxThreads itself.
+std::vector<unsigned> sweepThreadCounts(unsigned maxThreads) {
+    std::vector<unsigned> counts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) {
+        counts.push_back(threads);
+    }
+    counts.push_back(std::max(1u, maxThreads));
+    return counts;
+}
+
+// With more than one CPU requested, a parallel algorithm gets a pool of that many workers pinned to them
+// (pinTo keeps them off the first CPU, where the timing thread runs); null keeps the shared pool.
+std::unique_ptr<WorkStealingThreadPool> pinnedPoolFor(const Algorithm* algo, const BenchmarkOptions& options) {
+    if (!algo->isParallel() || options.cpus.size() < 2) {
+        return nullptr;
+    }
+    auto pool = std::make_unique<WorkStealingThreadPool>(static_cast<unsigned>(options.cpus.size()));
+    pool->pinTo(options.cpus);
+    return pool;
+}
+
+// Best time of several runs of execute() on a pool with the given number of threads.
+double bestExecutionMs(DataStructure* ds, Algorithm* algo, unsigned threads, int repetitions,
+                       const std::vector<unsigned>& cpus) {
+    WorkStealingThreadPool pool(threads);
+    if (!cpus.empty()) {
+        pool.pinTo(cpus);
+    }
+    ExecutionContext sweepContext;
+    sweepContext.pool = &pool;
+    ContextBinding binding(algo, &sweepContext, nullptr);
+    algo->setThreadCount(threads);
+    algo->prepare(ds);
+
+    double best = 0.0;
+    for (int run = 0; run < std::max(1, repetitions); ++run) {
+        auto start = std::chrono::high_resolution_clock::now();
+        algo->execute(ds);
+        auto end = std::chrono::high_resolution_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        best = run == 0 ? ms : std::min(best, ms);
+    }
+    return best;
+}
+#if defined(__linux__)
+// Pipe of a benchmark child to the parent, -1 in the parent or once the start of timing was reported.
+int timingStartFd = -1;
+
+// Tells the parent that the timed repetitions begin, so the budget leaves out fork, pool start-up and
+// prepare(). Only the first call writes; childMain calls it again before its report in case timing never
+// started.
+void signalTimingStart() {
+    if (timingStartFd < 0) {
+        return;
+    }
+    const char marker = 1;
+    while (write(timingStartFd, &marker, 1) < 0 && errno == EINTR) {
+    }
+    timingStartFd = -1;
+}
+
+// Fixed-size record the child writes to the parent through the pipe, after the one-byte timing marker.
+struct ChildReport {
+    int runs;
+    double bestMs;
+    double meanMs;
+    double userMs;
+    double systemMs;
+    long minorFaults;
+    long majorFaults;
+    long voluntarySwitches;
+    long involuntarySwitches;
+    long baselineRssKb;
+    long peakRssKb;
+    int failed;
+    char failure[256];
+};
+
+// One "Name: value kB" line of /proc/self/status, or 0.
+long statusKb(const char* field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    const std::string prefix = std::string(field) + ":";
+    while (std::getline(status, line)) {
+        if (line.compare(0, prefix.size(), prefix) == 0) {
+            return std::atol(line.c_str() + prefix.size());
+        }
+    }
+    return 0;
+}
+
+// Resident size of another process from /proc/<pid>/statm, in kB.
+long processRssKb(pid_t pid) {
+    std::ifstream statm("/proc/" + std::to_string(pid) + "/statm");
+    long size = 0, resident = 0;
+    statm >> size >> resident;
+    return resident * (sysconf(_SC_PAGE_SIZE) / 1024);
+}
+
+// write() until everything is out; the child has nothing better to do on failure.
+void writeAll(int fd, const void* data, std::size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        const ssize_t written = write(fd, bytes, size);
+        if (written <= 0) {
+            if (written < 0 && errno == EINTR) continue;
+            return;
+        }
+        bytes += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+// Runs in the child: applies the limits, measures the body and reports back. Never returns.
+[[noreturn]] void childMain(int fd, const BenchmarkOptions& options, unsigned poolThreads,
+                            const std::function<ExecutionSample(ThreadPool&)>& body) {
+    ChildReport report{};
+    timingStartFd = fd;
+    try {
+        // fork() copies only the calling thread, so the child gets its own pool before the limits apply
+        WorkStealingThreadPool pool(poolThreads);
+        if (!options.cpus.empty()) {
+            pool.pinTo(options.cpus);
+        }
+
+        if (options.cpuLimitSeconds > 0) {
+            const rlimit cpu{options.cpuLimitSeconds, options.cpuLimitSeconds + 1};
+            setrlimit(RLIMIT_CPU, &cpu);
+        }
+        if (options.addressSpaceLimitMb > 0) {
+            const rlim_t bytes = static_cast<rlim_t>(options.addressSpaceLimitMb) * 1024 * 1024;
+            const rlimit space{bytes, bytes};
+            setrlimit(RLIMIT_AS, &space);
+        }
+
+        // Hand free heap pages back and restart the high-water mark, so the figures cover this run only
+        malloc_trim(0);
+        std::ofstream("/proc/self/clear_refs") << "5";
+        report.baselineRssKb = statusKb("VmRSS");
+
+        const ExecutionSample sample = body(pool);
+        report.runs = sample.runs;
+        report.bestMs = sample.bestMs;
+        report.meanMs = sample.meanMs;
+        report.userMs = sample.userMs;
+        report.systemMs = sample.systemMs;
+        report.minorFaults = sample.minorFaults;
+        report.majorFaults = sample.majorFaults;
+        report.voluntarySwitches = sample.voluntarySwitches;
+        report.involuntarySwitches = sample.involuntarySwitches;
+        report.peakRssKb = statusKb("VmHWM");
+    } catch (const std::bad_alloc&) {
+        report.failed = 1;
+        const std::string reason = options.addressSpaceLimitMb > 0
+            ? "address space limit of " + std::to_string(options.addressSpaceLimitMb) + " MB exceeded (std::bad_alloc)"
+            : std::string("out of memory (std::bad_alloc)");
+        std::snprintf(report.failure, sizeof(report.failure), "%s", reason.c_str());
+    } catch (const std::exception& error) {
+        report.failed = 1;
+        std::snprintf(report.failure, sizeof(report.failure), "threw %s", error.what());
+    } catch (...) {
+        report.failed = 1;
+        std::snprintf(report.failure, sizeof(report.failure), "threw an unknown exception");
+    }
+    signalTimingStart();
+    writeAll(fd, &report, sizeof(report));
+    _exit(0);
+}
+
+// Forks, runs body in the child under the limits in options and turns the outcome into a sample. The
+// parent polls the child's RSS while it waits, since Linux does not enforce RLIMIT_RSS, and doubles as
+// the watchdog for the wall-clock budget, which it starts when the child's timing marker arrives.
+ExecutionSample runInChild(const BenchmarkOptions& options, unsigned poolThreads,
+                           const std::function<ExecutionSample(ThreadPool&)>& body) {
+    ExecutionSample sample;
+    sample.completed = false;
+
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) != 0) {
+        sample.failure = std::string("could not create a pipe (") + std::strerror(errno) + ")";
+        return sample;
+    }
+
+    // Buffered output would otherwise be written twice, once by each process
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+
+    const pid_t pid = fork();
+    if (pid < 0) {
+        sample.failure = std::string("fork failed (") + std::strerror(errno) + ")";
+        close(fds[0]);
+        close(fds[1]);
+        return sample;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        childMain(fds[1], options, poolThreads, body);
+    }
+    close(fds[1]);
+
+    auto started = std::chrono::steady_clock::now();
+    char message[1 + sizeof(ChildReport)];
+    std::size_t received = 0;
+    bool killedForRss = false;
+    bool killedForTime = false;
+    bool childExited = false;
+    pollfd reader{fds[0], POLLIN, 0};
+    while (received < sizeof(message)) {
+        const int ready = poll(&reader, 1, childExited ? 0 : 10);
+        if (ready < 0 && errno != EINTR) {
+            break;
+        }
+        if (ready == 0) {
+            // Children forked concurrently from other threads hold copies of this pipe, so EOF may never
+            // come; once the child is gone and the pipe is drained there is nothing left to wait for
+            if (childExited) {
+                break;
+            }
+            siginfo_t info{};
+            childExited = waitid(P_PID, static_cast<id_t>(pid), &info, WEXITED | WNOHANG | WNOWAIT) == 0 && info.si_pid == pid;
+        }
+        if (ready > 0) {
+            // EOF before a full report means the child died
+            const ssize_t count = read(fds[0], message + received, sizeof(message) - received);
+            if (count <= 0) {
+                break;
+            }
+            if (received == 0) {
+                started = std::chrono::steady_clock::now();
+            }
+            received += static_cast<std::size_t>(count);
+        }
+        if (!killedForRss && options.rssLimitMb > 0 &&
+            processRssKb(pid) > static_cast<long>(options.rssLimitMb) * 1024) {
+            kill(pid, SIGKILL);
+            killedForRss = true;
+        }
+        if (!killedForRss && !killedForTime && options.timeBudgetMs > 0.0 && received > 0 &&
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count() > options.timeBudgetMs) {
+            kill(pid, SIGKILL);
+            killedForTime = true;
+        }
+    }
+    close(fds[0]);
+    ChildReport report{};
+    if (received == sizeof(message)) {
+        std::memcpy(&report, message + 1, sizeof(report));
+    }
+
+    int status = 0;
+    rusage usage{};
+    while (wait4(pid, &status, 0, &usage) < 0 && errno == EINTR) {
+    }
+
+    if (killedForRss) {
+        sample.failure = "RSS limit of " + std::to_string(options.rssLimitMb) + " MB exceeded";
+    } else if (killedForTime) {
+        std::ostringstream failure;
+        failure << "timed out at > " << options.timeBudgetMs << " ms";
+        sample.failure = failure.str();
+        sample.timedOut = true;
+    } else if (WIFSIGNALED(status)) {
+        const int signal = WTERMSIG(status);
+        const double cpuSeconds = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec;
+        if (options.cpuLimitSeconds > 0 && (signal == SIGXCPU || (signal == SIGKILL && cpuSeconds >= options.cpuLimitSeconds))) {
+            sample.failure = "CPU time limit of " + std::to_string(options.cpuLimitSeconds) + " s exceeded";
+        } else {
+            sample.failure = "crashed with signal " + std::to_string(signal) + " (" + strsignal(signal) + ")";
+        }
+    } else if (received < sizeof(message)) {
+        sample.failure = "exited with status " + std::to_string(WIFEXITED(status) ? WEXITSTATUS(status) : -1) + " without a result";
+    } else if (report.failed) {
+        sample.failure = report.failure;
+    } else {
+        sample.runs = report.runs;
+        sample.bestMs = report.bestMs;
+        sample.meanMs = report.meanMs;
+        sample.userMs = report.userMs;
+        sample.systemMs = report.systemMs;
+        sample.minorFaults = report.minorFaults;
+        sample.majorFaults = report.majorFaults;
+        sample.voluntarySwitches = report.voluntarySwitches;
+        sample.involuntarySwitches = report.involuntarySwitches;
+        sample.completed = true;
+        sample.baselineRssKb = report.baselineRssKb;
+        sample.peakRssKb = report.peakRssKb;
+    }
+    return sample;
+}
+#endif
+} // namespace
+
+// Uses the process-wide pool, whose workers are started here rather than inside the first benchmark.
+BenchmarkManager::BenchmarkManager() : options(BenchmarkOptions::fromEnvironment()) {
+    context.pool = &WorkStealingThreadPool::shared();
+}
+
+// Swaps in a caller-owned pool.
+void BenchmarkManager::setThreadPool(ThreadPool* pool) {
+    context.pool = pool ? pool : &WorkStealingThreadPool::shared();
+}
+
+// Stores the isolation settings.
+void BenchmarkManager::setOptions(const BenchmarkOptions& newOptions) {
+    options = newOptions;
+}
+
+// Getter for the isolation settings.
+const BenchmarkOptions& BenchmarkManager::getOptions() const {
+    return options;
+}
+
+// Stores the build label.
+void BenchmarkManager::setBuildDescription(const std::string& description) {
+    buildDescription = description;
+}
+
 // Captures platform-specific RSS/shared/private memory stats after a run.
 void BenchmarkManager::getCurrentRSSBytes() {
 // UNIX systems
@@ -64,15 +599,332 @@ void BenchmarkManager::getLastRssBytes() {
 // Times the algorithm execution and reports both duration and RSS memory use.
 void BenchmarkManager::runBenchmark(DataStructure* ds, Algorithm* algo) {
     std::cout << "\nBenchmark Metrics =>" << std::endl;
+    std::cout << "\nBuild: " << (buildDescription.empty() ? PluginCompiler::hostBuildDescription() : buildDescription) << std::endl;
+
+#if defined(__linux__)
+    // A forked child reports its own memory, so earlier runs and loaded plugins do not show up
+    if (options.usesSubprocess()) {
+        std::cout << "\nIsolation: " << options.describe() << std::endl;
+        const ExecutionSample sample = sampleExecution(ds, algo, 1);
+        if (sample.timedOut) {
+            std::cout << "\nExecution time: " << sample.failure << " (the watchdog stopped the child)" << std::endl;
+            return;
+        }
+        if (!sample.completed) {
+            std::cout << "\nBenchmark aborted in the child process: " << sample.failure << std::endl;
+            return;
+        }
 
-    getLastRssBytes();
-    auto start = std::chrono::high_resolution_clock::now(); // start timing
-    algo->execute(ds); // polymorphic call
-    auto end = std::chrono::high_resolution_clock::now(); // end timing
-    getCurrentRSSBytes();
+        std::cout << "\nMemory usage of the child process:\n";
+        std::cout << "[Linux] RSS at start - " << sample.baselineRssKb << " kB\n";
+        std::cout << "[Linux] Peak RSS - " << sample.peakRssKb << " kB\n";
+        std::cout << "[Linux] Growth during the run - " << std::max(0L, sample.peakRssKb - sample.baselineRssKb) << " kB\n";
+        std::cout << "\nExecution time: " << sample.bestMs << "ms\n";
+        const std::size_t childRepetitions = algo->getRepetitions();
+        if (childRepetitions > 1) {
+            std::cout << "Time per repetition: " << sample.bestMs * 1e6 / static_cast<double>(childRepetitions)
+                      << "ns (" << childRepetitions << " repetitions)\n";
+        }
+        return;
+    }
+#endif
+
+    ExecutionContext runContext = context;
+    const std::unique_ptr<WorkStealingThreadPool> pinnedPool = pinnedPoolFor(algo, options);
+    if (pinnedPool) {
+        runContext.pool = pinnedPool.get();
+    }
+
+    // Untimed setup, e.g. the pre-sorted runs of a k-way merge
+    ContextBinding binding(algo, &runContext, &context);
+    std::chrono::high_resolution_clock::time_point start, end;
+    try {
+        algo->prepare(ds);
+        if (algo->isParallel()) {
+            std::cout << "\nThread pool: " << runContext.pool->threadCount() << " thread(s)" << std::endl;
+        }
+
+        if (options.any()) {
+            std::cout << "\nIsolation: " << options.describe() << std::endl;
+        }
+        RunIsolation isolation(options, ds);
+
+        getLastRssBytes();
+        start = std::chrono::high_resolution_clock::now(); // start timing
+        algo->execute(ds); // polymorphic call
+        end = std::chrono::high_resolution_clock::now(); // end timing
+        getCurrentRSSBytes();
+    } catch (const std::exception& error) {
+        // A failed run (e.g. a full disk under an external sort) ends this benchmark, not the session
+        std::cout << "\nBenchmark aborted: " << error.what() << std::endl;
+        return;
+    }
 
     // Calculate execution time in milliseconds
     double executionTimeMs = std::chrono::duration<double, std::milli>(end - start).count();
     std::cout << "\nExecution time: " << executionTimeMs << "ms\n";
 
+    // Tiny inputs are repeated inside execute(), so also report the cost of a single run
+    const std::size_t repetitions = algo->getRepetitions();
+    if (repetitions > 1) {
+        std::cout << "Time per repetition: " << executionTimeMs * 1e6 / static_cast<double>(repetitions)
+                  << "ns (" << repetitions << " repetitions)\n";
+    }
+
+}
+
+// Same isolation as runBenchmark, without the memory report.
+double BenchmarkManager::timeExecution(DataStructure* ds, Algorithm* algo, int repetitions) {
+    return sampleExecution(ds, algo, repetitions).bestMs;
+}
+
+// In a subprocess the child builds its own pool (the parent's workers do not survive fork): one worker per
+// requested CPU, pinned there, or the size of the current pool when no CPUs are given. In this process a
+// parallel algorithm gets the same pinned pool as in runBenchmark.
+ExecutionSample BenchmarkManager::sampleExecution(DataStructure* ds, Algorithm* algo, int repetitions) {
+#if defined(__linux__)
+    if (options.usesSubprocess()) {
+        const unsigned threads = !options.cpus.empty() ? static_cast<unsigned>(options.cpus.size()) : context.pool->threadCount();
+        return runInChild(options, threads, [&](ThreadPool& pool) {
+            context.pool = &pool;
+            return sampleInProcess(ds, algo, repetitions, context);
+        });
+    }
+#endif
+    ExecutionContext runContext = context;
+    const std::unique_ptr<WorkStealingThreadPool> pinnedPool = pinnedPoolFor(algo, options);
+    if (pinnedPool) {
+        runContext.pool = pinnedPool.get();
+    }
+
+    // In this process a throwing run fails its sample the way a child's does, instead of escaping the caller
+    try {
+        return sampleInProcess(ds, algo, repetitions, runContext);
+    } catch (const std::exception& error) {
+        ExecutionSample failed;
+        failed.completed = false;
+        failed.failure = std::string("threw ") + error.what();
+        return failed;
+    }
+}
+
+// The counters bracket all runs together, so per-run values are the totals divided by sample.runs.
+ExecutionSample BenchmarkManager::sampleInProcess(DataStructure* ds, Algorithm* algo, int repetitions,
+                                                  ExecutionContext& runContext) {
+    ContextBinding binding(algo, &runContext, &context);
+    algo->prepare(ds);
+
+    ExecutionSample sample;
+    sample.runs = std::max(1, repetitions);
+    double totalMs = 0.0;
+    {
+        QuietOutput quiet;
+        RunIsolation isolation(options, ds);
+#if defined(__linux__)
+        rusage before{};
+        getrusage(RUSAGE_SELF, &before);
+        signalTimingStart();
+#endif
+        for (int run = 0; run < sample.runs; ++run) {
+            auto start = std::chrono::high_resolution_clock::now();
+            algo->execute(ds);
+            auto end = std::chrono::high_resolution_clock::now();
+            const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            sample.bestMs = run == 0 ? ms : std::min(sample.bestMs, ms);
+            totalMs += ms;
+        }
+#if defined(__linux__)
+        rusage after{};
+        getrusage(RUSAGE_SELF, &after);
+        auto elapsedMs = [](const timeval& from, const timeval& to) {
+            return (to.tv_sec - from.tv_sec) * 1000.0 + (to.tv_usec - from.tv_usec) / 1000.0;
+        };
+        sample.userMs = elapsedMs(before.ru_utime, after.ru_utime);
+        sample.systemMs = elapsedMs(before.ru_stime, after.ru_stime);
+        sample.minorFaults = after.ru_minflt - before.ru_minflt;
+        sample.majorFaults = after.ru_majflt - before.ru_majflt;
+        sample.voluntarySwitches = after.ru_nvcsw - before.ru_nvcsw;
+        sample.involuntarySwitches = after.ru_nivcsw - before.ru_nivcsw;
+#endif
+    }
+    sample.meanMs = totalMs / sample.runs;
+    return sample;
+}
+
+// Every point gets a fresh pool of exactly that many threads so the hardware parallelism matches the
+// task count. Karp-Flatt: e = (1/S - 1/p) / (1 - 1/p); a serial fraction that grows with p points at
+// overhead (synchronization, memory bandwidth) rather than at inherently serial code.
+ScalingReport BenchmarkManager::runScalingSweep(DataStructure* ds, Algorithm* algo, unsigned maxThreads, int repetitions) {
+    ScalingReport report;
+    if (!algo->isParallel()) {
+        std::cout << "\n" << algo->getName() << " does not run on the thread pool; nothing to sweep." << std::endl;
+        return report;
+    }
+
+    const std::vector<int> base = ds->getElements();
+    const std::vector<unsigned> counts = sweepThreadCounts(maxThreads);
+    {
+        // Restores the thread count and the manager's context however the sweep ends
+        ContextBinding binding(algo, &context, &context);
+        RunIsolation isolation(options, nullptr);
+
+        for (unsigned threads : counts) {
+            ScalingPoint point;
+            point.threads = threads;
+            point.elements = base.size();
+            point.milliseconds = bestExecutionMs(ds, algo, threads, repetitions, options.cpus);
+            report.strong.push_back(point);
+        }
+
+        for (unsigned threads : counts) {
+            ReplicatedStructure scaled(base, threads, ds->getName());
+            ScalingPoint point;
+            point.threads = threads;
+            point.elements = base.size() * threads;
+            point.milliseconds = bestExecutionMs(&scaled, algo, threads, repetitions, options.cpus);
+            report.weak.push_back(point);
+        }
+    }
+
+    const double strongBase = report.strong.front().milliseconds;
+    for (ScalingPoint& point : report.strong) {
+        const double p = static_cast<double>(point.threads);
+        point.speedup = point.milliseconds > 0.0 ? strongBase / point.milliseconds : 0.0;
+        point.efficiency = point.speedup / p;
+        if (point.threads > 1 && point.speedup > 0.0) {
+            point.serialFraction = (1.0 / point.speedup - 1.0 / p) / (1.0 - 1.0 / p);
+        }
+    }
+
+    const double weakBase = report.weak.front().milliseconds;
+    for (ScalingPoint& point : report.weak) {
+        point.speedup = point.milliseconds > 0.0 ? weakBase / point.milliseconds : 0.0;
+        point.efficiency = point.speedup;
+    }
+
+
+    std::cout << "\nStrong scaling: " << algo->getName() << " on " << base.size() << " elements (best of "
+              << std::max(1, repetitions) << ", hardware threads: " << std::thread::hardware_concurrency() << ")\n";
+    std::cout << std::setw(8) << "Threads" << std::setw(12) << "Time (ms)" << std::setw(10) << "Speedup"
+              << std::setw(12) << "Efficiency" << std::setw(12) << "Karp-Flatt" << "\n";
+    std::cout << std::fixed;
+    for (const ScalingPoint& point : report.strong) {
+        std::cout << std::setw(8) << point.threads << std::setprecision(3) << std::setw(12) << point.milliseconds
+                  << std::setprecision(2) << std::setw(9) << point.speedup << "x" << std::setw(11)
+                  << point.efficiency * 100.0 << "%";
+        if (point.threads > 1) {
+            std::cout << std::setprecision(3) << std::setw(12) << point.serialFraction;
+        } else {
+            std::cout << std::setw(12) << "-";
+        }
+        std::cout << "\n";
+    }
+
+    std::cout << "\nWeak scaling: " << base.size() << " elements per thread\n";
+    std::cout << std::setw(8) << "Threads" << std::setw(12) << "Elements" << std::setw(12) << "Time (ms)"
+              << std::setw(12) << "Efficiency" << "\n";
+    for (const ScalingPoint& point : report.weak) {
+        std::cout << std::setw(8) << point.threads << std::setw(12) << point.elements << std::setprecision(3)
+                  << std::setw(12) << point.milliseconds << std::setprecision(2) << std::setw(11)
+                  << point.efficiency * 100.0 << "%\n";
+    }
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6);
+
+    return report;
+}
+
+// 1k, 2k, 5k, 10k, ... keeps the points evenly spaced on a log scale.
+std::vector<std::size_t> BenchmarkManager::sizeSweepSteps(std::size_t maxElements) {
+    std::vector<std::size_t> sizes;
+    for (std::size_t decade = 1000; decade < maxElements; decade *= 10) {
+        for (std::size_t step : {1u, 2u, 5u}) {
+            if (decade * step < maxElements) {
+                sizes.push_back(decade * step);
+            }
+        }
+    }
+    sizes.push_back(std::max<std::size_t>(1, maxElements));
+    return sizes;
+}
+
+// The budget covers the timed repetitions of each sample, not its prepare(). Every algorithm sees the same
+// prefix of one random sequence at each size, held in a plain list structure.
+std::vector<SizeSweepRow> BenchmarkManager::runSizeSweep(const std::vector<Algorithm*>& algorithms,
+                                                         const std::vector<std::size_t>& sizes, int repetitions) {
+    std::vector<std::size_t> ordered(sizes);
+    std::sort(ordered.begin(), ordered.end());
+    ordered.erase(std::unique(ordered.begin(), ordered.end()), ordered.end());
+
+    std::vector<int> values(ordered.empty() ? 0 : ordered.back());
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<> distribution(0, 100000);
+    for (int& value : values) {
+        value = distribution(generator);
+    }
+
+    std::vector<SizeSweepRow> rows;
+    for (Algorithm* algo : algorithms) {
+        SizeSweepRow row;
+        row.algorithm = algo->getName();
+        for (std::size_t elements : ordered) {
+            SizeSweepPoint point;
+            point.elements = elements;
+            if (row.cutoffElements > 0) {
+                point.skipped = true;
+                row.points.push_back(point);
+                continue;
+            }
+            ListStructure input;
+            for (std::size_t i = 0; i < elements; ++i) {
+                input.insert(values[i]);
+            }
+            point.sample = sampleExecution(&input, algo, repetitions);
+            if (!point.sample.completed) {
+                row.cutoffElements = elements;
+            }
+            row.points.push_back(point);
+        }
+        rows.push_back(row);
+    }
+
+    std::cout << "\nInput-size sweep: random inputs, best of " << std::max(1, repetitions) << ", ";
+    if (options.timeBudgetMs > 0.0) {
+        std::cout << "budget " << options.timeBudgetMs << " ms per size\n";
+    } else {
+        std::cout << "no time budget\n";
+    }
+    std::cout << std::left << std::setw(36) << "Algorithm" << std::right;
+    for (std::size_t elements : ordered) {
+        std::cout << std::setw(12) << ("n=" + std::to_string(elements));
+    }
+    std::cout << "\n" << std::fixed << std::setprecision(3);
+    for (const SizeSweepRow& row : rows) {
+        std::cout << std::left << std::setw(36) << row.algorithm << std::right;
+        for (const SizeSweepPoint& point : row.points) {
+            std::ostringstream budget;
+            budget << "> " << options.timeBudgetMs;
+            if (point.skipped) {
+                std::cout << std::setw(12) << "-";
+            } else if (point.sample.timedOut) {
+                std::cout << std::setw(12) << budget.str();
+            } else if (!point.sample.completed) {
+                std::cout << std::setw(12) << "failed";
+            } else {
+                std::cout << std::setw(12) << point.sample.bestMs;
+            }
+        }
+        std::cout << "\n";
+    }
+    for (const SizeSweepRow& row : rows) {
+        if (row.cutoffElements > 0) {
+            const SizeSweepPoint& last = *std::find_if(row.points.begin(), row.points.end(),
+                                                       [&](const SizeSweepPoint& point) { return point.elements == row.cutoffElements; });
+            std::cout << row.algorithm << ": " << last.sample.failure << " at n=" << row.cutoffElements
+                      << (row.cutoffElements < ordered.back() ? "; larger sizes skipped" : "") << "\n";
+        }
+    }
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6) << std::flush;
+    return rows;
 }
@@ -0,0 +1,143 @@
+// src/manager/BenchmarkOptions.cpp
+#include "../../include/manager/BenchmarkOptions.hpp"
+#include <cstdlib>
+#include <sstream>
+
+// Namespace for internal linkage
+namespace {
+// Parses a non-negative integer that spans the whole string.
+bool parseNumber(const std::string& text, long& value) {
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos || text.size() > 6) {
+        return false;
+    }
+    value = std::stol(text);
+    return true;
+}
+
+// True when the variable is set to exactly "1".
+bool environmentFlag(const char* name) {
+    const char* value = std::getenv(name);
+    return value && std::string(value) == "1";
+}
+} // namespace
+
+// Any isolation requested at all.
+bool BenchmarkOptions::any() const {
+    return !cpus.empty() || realtime || lockMemory || prefault || usesSubprocess();
+}
+
+// Limits and budgets can only be enforced from outside the benchmarked process.
+bool BenchmarkOptions::usesSubprocess() const {
+    return subprocess || cpuLimitSeconds > 0 || addressSpaceLimitMb > 0 || rssLimitMb > 0 || timeBudgetMs > 0.0;
+}
+
+// Joins the enabled settings for the benchmark header.
+std::string BenchmarkOptions::describe() const {
+    std::ostringstream out;
+    std::string separator;
+    if (!cpus.empty()) {
+        out << "cpus ";
+        for (std::size_t i = 0; i < cpus.size(); ++i) {
+            out << (i ? "," : "") << cpus[i];
+        }
+        separator = "; ";
+    }
+    if (realtime) {
+        out << separator << "SCHED_FIFO";
+        if (realtimePriority > 0) {
+            out << " " << realtimePriority;
+        }
+        separator = "; ";
+    }
+    if (lockMemory) {
+        out << separator << "mlockall";
+        separator = "; ";
+    }
+    if (prefault) {
+        out << separator << "prefault";
+        separator = "; ";
+    }
+    if (usesSubprocess()) {
+        out << separator << "subprocess";
+        std::string limitSeparator = " (";
+        if (cpuLimitSeconds > 0) {
+            out << limitSeparator << "cpu " << cpuLimitSeconds << " s";
+            limitSeparator = ", ";
+        }
+        if (addressSpaceLimitMb > 0) {
+            out << limitSeparator << "as " << addressSpaceLimitMb << " MB";
+            limitSeparator = ", ";
+        }
+        if (rssLimitMb > 0) {
+            out << limitSeparator << "rss " << rssLimitMb << " MB";
+            limitSeparator = ", ";
+        }
+        if (timeBudgetMs > 0.0) {
+            out << limitSeparator << "budget " << timeBudgetMs << " ms";
+            limitSeparator = ", ";
+        }
+        out << (limitSeparator == ", " ? ")" : "");
+        separator = "; ";
+    }
+    return separator.empty() ? "none" : out.str();
+}
+
+// Comma-separated entries, each a CPU number or an inclusive range "a-b".
+bool BenchmarkOptions::parseCpuList(const std::string& text, std::vector<unsigned>& cpus) {
+    std::vector<unsigned> parsed;
+    std::stringstream stream(text);
+    std::string entry;
+    while (std::getline(stream, entry, ',')) {
+        const std::size_t dash = entry.find('-');
+        long first = 0, last = 0;
+        if (dash == std::string::npos) {
+            if (!parseNumber(entry, first)) return false;
+            last = first;
+        } else if (!parseNumber(entry.substr(0, dash), first) || !parseNumber(entry.substr(dash + 1), last) ||
+                   last < first) {
+            return false;
+        }
+        for (long cpu = first; cpu <= last; ++cpu) {
+            parsed.push_back(static_cast<unsigned>(cpu));
+        }
+    }
+    if (parsed.empty()) {
+        return false;
+    }
+    cpus = parsed;
+    return true;
+}
+
+// Unset or malformed variables leave the matching setting off.
+BenchmarkOptions BenchmarkOptions::fromEnvironment() {
+    BenchmarkOptions options;
+    if (const char* cpus = std::getenv("RAYSTRUCT_BENCH_CPUS")) {
+        parseCpuList(cpus, options.cpus);
+    }
+    if (const char* fifo = std::getenv("RAYSTRUCT_BENCH_FIFO")) {
+        long priority = 0;
+        if (parseNumber(fifo, priority)) {
+            options.realtime = true;
+            options.realtimePriority = static_cast<int>(priority);
+        }
+    }
+    options.lockMemory = environmentFlag("RAYSTRUCT_BENCH_MLOCK");
+    options.prefault = environmentFlag("RAYSTRUCT_BENCH_PREFAULT");
+    options.subprocess = environmentFlag("RAYSTRUCT_BENCH_FORK");
+
+    // Each limit implies the fork (see usesSubprocess)
+    long limit = 0;
+    if (const char* cpu = std::getenv("RAYSTRUCT_BENCH_CPU_LIMIT"); cpu && parseNumber(cpu, limit)) {
+        options.cpuLimitSeconds = static_cast<unsigned>(limit);
+    }
+    if (const char* space = std::getenv("RAYSTRUCT_BENCH_AS_LIMIT_MB"); space && parseNumber(space, limit)) {
+        options.addressSpaceLimitMb = static_cast<std::size_t>(limit);
+    }
+    if (const char* rss = std::getenv("RAYSTRUCT_BENCH_RSS_LIMIT_MB"); rss && parseNumber(rss, limit)) {
+        options.rssLimitMb = static_cast<std::size_t>(limit);
+    }
+    if (const char* budget = std::getenv("RAYSTRUCT_BENCH_BUDGET_MS"); budget && parseNumber(budget, limit)) {
+        options.timeBudgetMs = static_cast<double>(limit);
+    }
+    return options;
+}
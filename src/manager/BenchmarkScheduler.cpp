@@ -0,0 +1,284 @@
+// src/manager/BenchmarkScheduler.cpp
+#include "../../include/manager/BenchmarkScheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+// Namespace alias for filesystem
+namespace fs = std::filesystem;
+
+// Namespace for internal linkage
+namespace {
+// First line of a sysfs file, or an empty string when it cannot be read.
+std::string readFirstLine(const fs::path& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+// CPU list of the level-3 cache shared by cpu, or an empty string when the machine reports none.
+std::string l3SharedList(const fs::path& cpuDirectory) {
+    std::error_code ec;
+    for (fs::directory_iterator it(cpuDirectory / "cache", ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().filename().string().rfind("index", 0) == 0 && readFirstLine(it->path() / "level") == "3") {
+            return readFirstLine(it->path() / "shared_cpu_list");
+        }
+    }
+    return "";
+}
+
+// Smallest entry of a non-empty CPU list, used to order cores and domains.
+unsigned firstCpu(const std::vector<unsigned>& cpus) {
+    return *std::min_element(cpus.begin(), cpus.end());
+}
+} // namespace
+
+// Cores and domains are keyed by their sysfs list, so each one is found once however many CPUs name it.
+CoreTopology CoreTopology::fromSysfs(const std::string& sysfsRoot, const std::vector<unsigned>& cpus) {
+    CoreTopology topology;
+    std::vector<unsigned> allowed(cpus);
+    std::sort(allowed.begin(), allowed.end());
+    allowed.erase(std::unique(allowed.begin(), allowed.end()), allowed.end());
+
+    std::map<std::string, std::size_t> coreBySiblings;
+    std::map<std::string, std::vector<std::size_t>> coresByL3;
+    std::vector<std::string> l3Order;
+    for (unsigned cpu : allowed) {
+        const fs::path directory = fs::path(sysfsRoot) / ("cpu" + std::to_string(cpu));
+        std::string siblings = readFirstLine(directory / "topology" / "thread_siblings_list");
+        if (siblings.empty()) {
+            siblings = std::to_string(cpu);
+        }
+
+        auto known = coreBySiblings.find(siblings);
+        if (known != coreBySiblings.end()) {
+            topology.cores[known->second].push_back(cpu);
+            continue;
+        }
+        coreBySiblings[siblings] = topology.cores.size();
+        topology.cores.push_back({cpu});
+
+        const std::string l3 = l3SharedList(directory);
+        if (coresByL3.find(l3) == coresByL3.end()) {
+            l3Order.push_back(l3);
+        }
+        coresByL3[l3].push_back(topology.cores.size() - 1);
+    }
+
+    // CPUs were visited in ascending order, so cores and domains already come out sorted by their first CPU
+    for (const std::string& l3 : l3Order) {
+        topology.l3Domains.push_back(coresByL3[l3]);
+    }
+    return topology;
+}
+
+// Falls back to every CPU std::thread reports when the affinity mask cannot be read.
+CoreTopology CoreTopology::detect() {
+    std::vector<unsigned> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (unsigned cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        for (unsigned cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return fromSysfs("/sys/devices/system/cpu", cpus);
+}
+
+// Keeps a copy of the topology.
+BenchmarkScheduler::BenchmarkScheduler(const CoreTopology& machine) : topology(machine) {}
+
+// Setter for the slot size.
+void BenchmarkScheduler::setGranularity(SlotGranularity slotGranularity) {
+    granularity = slotGranularity;
+}
+
+// Stores the settings copied into every child.
+void BenchmarkScheduler::setOptions(const BenchmarkOptions& baseOptions) {
+    options = baseOptions;
+}
+
+// Turns concurrency off for the whole batch.
+void BenchmarkScheduler::setForceSerial(bool enabled) {
+    forceSerial = enabled;
+}
+
+// Setter for the slot cap.
+void BenchmarkScheduler::setMaxConcurrent(std::size_t slotCount) {
+    maxConcurrent = slotCount;
+}
+
+// Core slots are dealt round-robin over the L3 domains: the first core of every domain, then the second, ...
+std::vector<std::vector<unsigned>> BenchmarkScheduler::slots() const {
+    std::vector<std::vector<unsigned>> result;
+    if (granularity == SlotGranularity::L3) {
+        for (const std::vector<std::size_t>& domain : topology.l3Domains) {
+            std::vector<unsigned> cpus;
+            for (std::size_t core : domain) {
+                cpus.push_back(firstCpu(topology.cores[core]));
+            }
+            result.push_back(cpus);
+        }
+    } else {
+        std::size_t widest = 0;
+        for (const std::vector<std::size_t>& domain : topology.l3Domains) {
+            widest = std::max(widest, domain.size());
+        }
+        for (std::size_t position = 0; position < widest; ++position) {
+            for (const std::vector<std::size_t>& domain : topology.l3Domains) {
+                if (position < domain.size()) {
+                    result.push_back({firstCpu(topology.cores[domain[position]])});
+                }
+            }
+        }
+    }
+
+    if (maxConcurrent > 0 && result.size() > maxConcurrent) {
+        result.resize(maxConcurrent);
+    }
+    if (result.empty()) {
+        result.push_back({});
+    }
+    return result;
+}
+
+// Each worker thread owns a BenchmarkManager whose options pin the child to that worker's slot; the
+// parent threads only fork, poll and wait, so they do not compete with the children for CPU time.
+std::vector<ScheduledRun> BenchmarkScheduler::run(const std::vector<BenchmarkScenario>& scenarios) const {
+    std::vector<ScheduledRun> results(scenarios.size());
+    const std::vector<std::vector<unsigned>> slotCpus = slots();
+
+    std::vector<std::size_t> concurrent;
+    std::vector<std::size_t> serial;
+    for (std::size_t i = 0; i < scenarios.size(); ++i) {
+#if defined(__linux__)
+        const bool alone = forceSerial || scenarios[i].serial || slotCpus.size() < 2;
+#else
+        // Without fork every run shares this process, so nothing may overlap
+        const bool alone = true;
+#endif
+        (alone ? serial : concurrent).push_back(i);
+    }
+
+    std::mutex outputMutex;
+    auto runOne = [&](BenchmarkManager& manager, std::size_t index, const std::vector<unsigned>& cpus, bool alone) {
+        const BenchmarkScenario& scenario = scenarios[index];
+        ScheduledRun& result = results[index];
+        result.scenario = scenario.name;
+        result.cpus = cpus;
+        result.serial = alone;
+
+        const auto start = std::chrono::steady_clock::now();
+        if (scenario.ds && scenario.algo) {
+            result.sample = manager.sampleExecution(scenario.ds, scenario.algo, scenario.repetitions);
+        } else {
+            result.sample.completed = false;
+            result.sample.failure = "no structure or algorithm";
+        }
+        result.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::lock_guard<std::mutex> lock(outputMutex);
+        std::cout << "[Scheduler] " << scenario.name << " on cpus " << formatCpus(cpus) << ": "
+                  << (result.sample.completed ? "done" : result.sample.failure) << std::endl;
+    };
+
+    auto managerFor = [&](BenchmarkManager& manager, const std::vector<unsigned>& cpus) {
+        BenchmarkOptions slotOptions = options;
+        slotOptions.cpus = cpus;
+        slotOptions.subprocess = true;
+        manager.setOptions(slotOptions);
+    };
+
+    std::cout << "\n[Scheduler] " << scenarios.size() << " scenario(s): " << concurrent.size() << " concurrent on "
+              << std::min(slotCpus.size(), concurrent.size()) << " slot(s), " << serial.size() << " serial" << std::endl;
+
+    const auto batchStart = std::chrono::steady_clock::now();
+    const std::size_t workerCount = std::min(slotCpus.size(), concurrent.size());
+    std::vector<BenchmarkManager> managers(workerCount);
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> workers;
+    for (std::size_t w = 0; w < workerCount; ++w) {
+        managerFor(managers[w], slotCpus[w]);
+        workers.emplace_back([&, w]() {
+            for (std::size_t taken = next++; taken < concurrent.size(); taken = next++) {
+                runOne(managers[w], concurrent[taken], slotCpus[w], false);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    if (!serial.empty()) {
+        BenchmarkManager manager;
+        managerFor(manager, slotCpus.front());
+        for (std::size_t index : serial) {
+            runOne(manager, index, slotCpus.front(), true);
+        }
+    }
+    const double batchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - batchStart).count();
+
+    double backToBackMs = 0.0;
+    std::cout << "\nScheduled batch (" << (granularity == SlotGranularity::L3 ? "L3-domain" : "per-core") << " slots)\n";
+    std::cout << std::left << std::setw(36) << "Scenario" << std::setw(12) << "CPUs" << std::right << std::setw(11)
+              << "Best (ms)" << std::setw(11) << "Mean (ms)" << std::setw(11) << "Wall (ms)" << "\n";
+    std::cout << std::fixed << std::setprecision(3);
+    for (const ScheduledRun& result : results) {
+        backToBackMs += result.wallMs;
+        std::cout << std::left << std::setw(36) << result.scenario
+                  << std::setw(12) << (formatCpus(result.cpus) + (result.serial ? " (s)" : "")) << std::right;
+        if (!result.sample.completed) {
+            std::cout << "  " << result.sample.failure << "\n";
+            continue;
+        }
+        std::cout << std::setw(11) << result.sample.bestMs << std::setw(11) << result.sample.meanMs << std::setw(11)
+                  << result.wallMs << "\n";
+    }
+    std::cout << std::setprecision(1) << "Batch wall time " << batchMs << " ms; back to back it would take about "
+              << backToBackMs << " ms\n";
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6) << std::flush;
+    return results;
+}
+
+// Collapses runs of consecutive CPUs into ranges.
+std::string BenchmarkScheduler::formatCpus(const std::vector<unsigned>& cpus) {
+    if (cpus.empty()) {
+        return "any";
+    }
+    std::vector<unsigned> sorted(cpus);
+    std::sort(sorted.begin(), sorted.end());
+    std::ostringstream out;
+    for (std::size_t i = 0; i < sorted.size();) {
+        std::size_t j = i;
+        while (j + 1 < sorted.size() && sorted[j + 1] == sorted[j] + 1) {
+            ++j;
+        }
+        out << (i ? "," : "") << sorted[i];
+        if (j > i) {
+            out << "-" << sorted[j];
+        }
+        i = j + 1;
+    }
+    return out.str();
+}
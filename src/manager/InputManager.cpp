@@ -42,9 +42,20 @@ AlgorithmEnum InputManager::parseAlgorithm(const std::string& input) {
     std::transform(s.begin(), s.end(), s.begin(), ::tolower);
 
     if (s == "merge sort") return AlgorithmEnum::MERGE_SORT;
+    if (s == "external merge sort" || s == "external sort") return AlgorithmEnum::EXTERNAL_MERGE_SORT;
+    if (s == "k-way merge" || s == "kway merge" || s == "k-way") return AlgorithmEnum::KWAY_MERGE;
     if (s == "insertion sort") return AlgorithmEnum::INSERTION_SORT;
+    if (s == "simd sort" || s == "simd") return AlgorithmEnum::SIMD_SORT;
+    if (s == "radix sort" || s == "radix") return AlgorithmEnum::RADIX_SORT;
+    if (s == "std sort" || s == "std::sort" || s == "std") return AlgorithmEnum::STD_SORT;
+    if (s == "pdqsort" || s == "pdq sort" || s == "introsort") return AlgorithmEnum::PDQ_SORT;
+    if (s == "sorting network" || s == "network") return AlgorithmEnum::SORTING_NETWORK;
     if (s == "heap build") return AlgorithmEnum::HEAP_BUILD;
     if (s == "heap selection") return AlgorithmEnum::HEAP_SELECTION;
+    if (s == "quickselect" || s == "quick select" || s == "introselect") return AlgorithmEnum::QUICK_SELECT;
+    if (s == "simd selection" || s == "top-k") return AlgorithmEnum::SIMD_SELECTION;
+    if (s == "streaming selection" || s == "streaming") return AlgorithmEnum::STREAMING_SELECTION;
+    if (s == "parallel selection" || s == "parallel") return AlgorithmEnum::PARALLEL_SELECTION;
     if (s == "a*" || s == "astar" || s == "a-star") return AlgorithmEnum::A_STAR;
     if (s == "prim" || s == "prims" || s == "prim's") return AlgorithmEnum::PRIMS;
     if (s == "custom") return AlgorithmEnum::CUSTOM;
@@ -53,7 +64,8 @@ AlgorithmEnum InputManager::parseAlgorithm(const std::string& input) {
 }
 
 // Drives the wizard for loading, validating, and compiling a custom structure file.
-bool InputManager::promptCustomStructurePath(std::string& outPath, std::string& compilerOutput, std::string& libraryPath) {
+bool InputManager::promptCustomStructurePath(std::string& outPath, std::string& compilerOutput, std::string& libraryPath,
+                                             std::string& buildDescription) {
     while (true) {
         std::cout << "\nEnter the path to your custom data structure .cpp file ('exit' to quit)" << std::endl;
         std::cout << ">>> ";
@@ -112,9 +124,13 @@ bool InputManager::promptCustomStructurePath(std::string& outPath, std::string&
         }
 
         // Compile
-        std::string compileOutput;
-        std::string compiledLibraryPath;
-        if (!compileCustomStructure(normalized.string(), compileOutput, compiledLibraryPath)) {
+        if (!promptBuildProfile()) {
+            return false;
+        }
+        PluginBuild build;
+        const bool compiled = compileCustomStructure(normalized.string(), build);
+        const std::string& compileOutput = build.compilerOutput;
+        if (!compiled) {
             std::cout << "\nCompilation of custom data structure failed." << std::endl;
             if (!compileOutput.empty()) std::cout << compileOutput << std::endl;
             std::cout << "Please address the compiler errors and try again." << std::endl;
@@ -122,7 +138,9 @@ bool InputManager::promptCustomStructurePath(std::string& outPath, std::string&
         }
 
         // Compilation succeeded
-        if (!compileOutput.empty()) {
+        if (build.fromCache) {
+            std::cout << "\nSource, headers, compiler and flags are unchanged; reusing the cached build." << std::endl;
+        } else if (!compileOutput.empty()) {
             std::cout << "\nCompilation succeeded with messages:\n" << compileOutput << std::endl;
         } else {
             std::cout << "\nCompilation succeeded with no warnings." << std::endl;
@@ -131,9 +149,10 @@ bool InputManager::promptCustomStructurePath(std::string& outPath, std::string&
         // Output results
         outPath = normalized.string();
         compilerOutput = compileOutput;
-        libraryPath = compiledLibraryPath;
+        libraryPath = build.libraryPath;
+        buildDescription = build.describe();
         std::cout << "\nCustom data structure path accepted: " << outPath << std::endl;
-        std::cout << "Generated shared library: " << libraryPath << std::endl;
+        std::cout << "Generated shared library: " << libraryPath << " [" << buildDescription << "]" << std::endl;
         return true;
     }
 }
@@ -183,76 +202,29 @@ bool InputManager::validateCustomStructureFile(const std::string& filePath, std:
     }
 
     // Check for factory method
-    if (lowercaseContent.find("createdatastructure(") == std::string::npos) {
-        errorMessage = "missing factory function 'createDataStructure'";
+    if (lowercaseContent.find("createdatastructure(") == std::string::npos &&
+        lowercaseContent.find("raystructregistry(") == std::string::npos) {
+        errorMessage = "missing factory function 'createDataStructure' (or a 'raystructRegistry')";
         return false;
     }
 
     return true;
 }
 
-// Invokes g++ to turn the validated custom structure source into a shared object we can dlopen.
-bool InputManager::compileCustomStructure(const std::string& filePath, std::string& compilerOutput, std::string& libraryPath) {
-    fs::path sourcePath(__FILE__);
-    fs::path projectRoot = sourcePath.parent_path().parent_path().parent_path();
-    fs::path includeDir = projectRoot / "include";
-
-    // Ensure output directory exists
-    fs::path dsDir = projectRoot / "src" / "structure";
-    std::error_code dirEc;
-    fs::create_directories(dsDir, dirEc);
-
-    // Prepare output path
-    fs::path inputPath(filePath);
-    std::string stem = inputPath.stem().string();
-    if (stem.empty()) stem = "custom_datastructure";
-
-    // Sanitize filename
-    std::replace_if(stem.begin(), stem.end(), [](unsigned char c) {
-        return !std::isalnum(static_cast<unsigned char>(c)) && c != '_';
-    }, '_');
-
-    fs::path libraryFile = dsDir / (stem + "_custom.so");
-    std::error_code removeEc;
-    fs::remove(libraryFile, removeEc);
-
-    fs::path logPath = "raystruct_custom_ds.txt";
-
-    // Build g++ command
-    std::ostringstream cmdStream;
-    cmdStream << "g++ -std=c++17 -shared -fPIC -Wall -Wextra"
-              << " -I\"" << includeDir.string() << "\""
-              << " -I\"" << (projectRoot / "src").string() << "\""
-              << " \"" << filePath << "\""
-              << " -o \"" << libraryFile.string() << "\""
-              << " >\"" << logPath.string() << "\" 2>&1";
-
-    int result = std::system(cmdStream.str().c_str());
-
-    // Read compiler output
-    compilerOutput.clear();
-    {
-        std::ifstream logStream(logPath);
-        if (logStream.is_open()) {
-            std::ostringstream oss;
-            oss << logStream.rdbuf();
-            compilerOutput = oss.str();
-        }
+// Builds the validated custom structure with the selected profile, through the plugin cache when it is writable.
+bool InputManager::compileCustomStructure(const std::string& filePath, PluginBuild& build) {
+    fs::path projectRoot = fs::path(__FILE__).parent_path().parent_path().parent_path();
+    if (pluginCache.isUsable()) {
+        build = pluginCompiler.compile(filePath, pluginCache);
+    } else {
+        build = pluginCompiler.compile(filePath, (projectRoot / "src" / "structure").string());
     }
-
-    fs::remove(logPath, removeEc);
-
-    if (result != 0) {
-        fs::remove(libraryFile, removeEc);
-        return false;
-    }
-
-    libraryPath = libraryFile.string();
-    return true;
+    return build.succeeded;
 }
 
 // Guides the user through selecting, validating, and building a custom algorithm implementation.
-bool InputManager::promptCustomAlgorithmPath(std::string& outPath, std::string& compilerOutput, std::string& libraryPath) {
+bool InputManager::promptCustomAlgorithmPath(std::string& outPath, std::string& compilerOutput, std::string& libraryPath,
+                                             std::string& buildDescription) {
     while (true) {
         std::cout << "\nEnter the path to your custom algorithm .cpp file ('exit' to quit)" << std::endl;
         std::cout << ">>> ";
@@ -315,9 +287,13 @@ bool InputManager::promptCustomAlgorithmPath(std::string& outPath, std::string&
         }
 
         // Compile the custom algorithm
-        std::string compileOutput;
-        std::string compiledLibraryPath;
-        if (!compileCustomAlgorithm(normalized.string(), compileOutput, compiledLibraryPath)) {
+        if (!promptBuildProfile()) {
+            return false;
+        }
+        PluginBuild build;
+        const bool compiled = compileCustomAlgorithm(normalized.string(), build);
+        const std::string& compileOutput = build.compilerOutput;
+        if (!compiled) {
             std::cout << "\nCompilation of custom algorithm failed." << std::endl;
             if (!compileOutput.empty()) {
                 std::cout << compileOutput << std::endl;
@@ -327,7 +303,9 @@ bool InputManager::promptCustomAlgorithmPath(std::string& outPath, std::string&
         }
 
         // Compilation succeeded
-        if (!compileOutput.empty()) {
+        if (build.fromCache) {
+            std::cout << "\nSource, headers, compiler and flags are unchanged; reusing the cached build." << std::endl;
+        } else if (!compileOutput.empty()) {
             std::cout << "\nCompilation succeeded with messages:\n" << compileOutput << std::endl;
         } else {
             std::cout << "\nCompilation succeeded with no warnings." << std::endl;
@@ -336,9 +314,10 @@ bool InputManager::promptCustomAlgorithmPath(std::string& outPath, std::string&
         // Set output parameters
         outPath = normalized.string();
         compilerOutput = compileOutput;
-        libraryPath = compiledLibraryPath;
+        libraryPath = build.libraryPath;
+        buildDescription = build.describe();
         std::cout << "\nCustom algorithm path accepted: " << outPath << std::endl;
-        std::cout << "Generated shared library: " << libraryPath << std::endl;
+        std::cout << "Generated shared library: " << libraryPath << " [" << buildDescription << "]" << std::endl;
         return true;
     }
 }
@@ -367,6 +346,19 @@ bool InputManager::validateCustomAlgorithmFile(const std::string& filePath, std:
         return static_cast<char>(std::tolower(c));
     });
 
+    // Raw-buffer plugins export the C entry point instead of an Algorithm subclass
+    if (lowercaseContent.find(RAYSTRUCT_PLUGIN_ENTRY) != std::string::npos) {
+        if (lowercaseContent.find("pluginabi.hpp") == std::string::npos) {
+            errorMessage = "raw-buffer plugin does not include 'PluginAbi.hpp'";
+            return false;
+        }
+        if (lowercaseContent.find("extern \"c\"") == std::string::npos) {
+            errorMessage = std::string("entry point '") + RAYSTRUCT_PLUGIN_ENTRY + "' must be declared extern \"C\"";
+            return false;
+        }
+        return true;
+    }
+
     // Check for required elements
     // Check for include of Algorithm.hpp
     if (lowercaseContent.find("algorithm.hpp") == std::string::npos) {
@@ -393,8 +385,9 @@ bool InputManager::validateCustomAlgorithmFile(const std::string& filePath, std:
     }
 
     // Check for factory function that will be used for linkage at runtime
-    if (lowercaseContent.find("createalgorithm(") == std::string::npos) {
-        errorMessage = "missing factory function 'createAlgorithm'";
+    if (lowercaseContent.find("createalgorithm(") == std::string::npos &&
+        lowercaseContent.find("raystructregistry(") == std::string::npos) {
+        errorMessage = "missing factory function 'createAlgorithm' (or a 'raystructRegistry')";
         return false;
     }
 
@@ -402,73 +395,53 @@ bool InputManager::validateCustomAlgorithmFile(const std::string& filePath, std:
 }
 
 // Compiles the custom algorithm source into a plugin so the benchmark harness can load it.
-bool InputManager::compileCustomAlgorithm(const std::string& filePath, std::string& compilerOutput, std::string& libraryPath) {
-    // Determine project root and include paths
-    fs::path sourcePath(__FILE__);
-    fs::path projectRoot = sourcePath.parent_path().parent_path().parent_path();
-    fs::path includeDir = projectRoot / "include";
-
-    // Ensure output directory exists
-    fs::path algorithmDir = projectRoot / "src" / "algorithm";
-    std::error_code dirEc;
-    fs::create_directories(algorithmDir, dirEc);
-
-    // Prepare output library path
-    fs::path inputPath(filePath);
-    std::string stem = inputPath.stem().string();
-    if (stem.empty()) {
-        stem = "custom_algorithm";
+bool InputManager::compileCustomAlgorithm(const std::string& filePath, PluginBuild& build) {
+    fs::path projectRoot = fs::path(__FILE__).parent_path().parent_path().parent_path();
+    if (pluginCache.isUsable()) {
+        build = pluginCompiler.compile(filePath, pluginCache);
+    } else {
+        build = pluginCompiler.compile(filePath, (projectRoot / "src" / "algorithm").string());
     }
+    return build.succeeded;
+}
+
+// Offers the build profiles; an empty answer keeps the current one (O2 unless changed earlier).
+bool InputManager::promptBuildProfile() {
+    while (true) {
+        std::cout << "\nSelect build profile (Debug, O2, O3, LTO, Custom) [" << PluginCompiler::profileName(pluginCompiler.getProfile()) << "]" << std::endl;
+        std::cout << ">>> ";
 
-    // Sanitize stem to be filesystem-friendly
-    std::replace_if(stem.begin(), stem.end(), [](unsigned char c) {
-        return !std::isalnum(static_cast<unsigned char>(c)) && c != '_';
-    }, '_');
-
-    // Remove any existing library file
-    fs::path libraryFile = algorithmDir / (stem + "_custom.so");
-    std::error_code removeEc;
-    fs::remove(libraryFile, removeEc);
-
-    // Log file for compiler output
-    fs::path logPath = "raystruct_custom_algo.txt";
-
-    // Construct compilation command
-    std::ostringstream cmdStream;
-    cmdStream << "g++ -std=c++17 -shared -fPIC -Wall -Wextra"
-              << " -I\"" << includeDir.string() << "\""
-              << " -I\"" << (projectRoot / "src").string() << "\""
-              << " \"" << filePath << "\""
-              << " -o \"" << libraryFile.string() << "\""
-              << " >\"" << logPath.string() << "\" 2>&1";
-
-    // Execute compilation command
-    int result = std::system(cmdStream.str().c_str());
-
-    // Read compiler output from log file
-    compilerOutput.clear();
-    {
-        std::ifstream logStream(logPath);
-        if (logStream.is_open()) {
-            std::ostringstream oss;
-            oss << logStream.rdbuf();
-            compilerOutput = oss.str();
+        std::string input;
+        std::getline(std::cin, input);
+        input = trim(input);
+
+        if (input == "exit") {
+            return false;
+        }
+        if (input.empty()) {
+            return true;
         }
-    }
 
-    // Clean up log file
-    std::error_code ec;
-    fs::remove(logPath, ec);
+        BuildProfile profile;
+        if (!PluginCompiler::parseProfile(input, profile)) {
+            std::cout << "\nUnknown build profile. Try again." << std::endl;
+            continue;
+        }
 
-    // Check compilation result
-    if (result != 0) {
-        fs::remove(libraryFile, ec);
-        return false;
-    }
+        if (profile == BuildProfile::CUSTOM) {
+            std::cout << "\nEnter compiler flags (e.g. -O2 -funroll-loops)" << std::endl;
+            std::cout << ">>> ";
+            std::string flags;
+            std::getline(std::cin, flags);
+            if (!pluginCompiler.setCustomFlags(trim(flags))) {
+                std::cout << "\nFlags may not contain shell metacharacters. Try again." << std::endl;
+                continue;
+            }
+        }
 
-    // Compilation succeeded
-    libraryPath = libraryFile.string();
-    return true;
+        pluginCompiler.setProfile(profile);
+        return true;
+    }
 }
 
 // Repeatedly prompts until the user selects a valid data structure or chooses to exit.
@@ -495,7 +468,8 @@ InputManager::StructureSelection InputManager::selectStructure() {
         if (structure == DataStructureEnum::CUSTOM) {
             std::cout << "\nSelected custom data structure." << std::endl;
             std::cout << "Ensure your implementation derives from the 'DataStructure' base class provided by RayStruct++." << std::endl;
-            if (!promptCustomStructurePath(selection.customStructurePath, selection.customStructureCompileOutput, selection.customStructureLibraryPath)) {
+            if (!promptCustomStructurePath(selection.customStructurePath, selection.customStructureCompileOutput,
+                                           selection.customStructureLibraryPath, selection.customStructureBuild)) {
                selection.shouldExit = true;
                structure = DataStructureEnum::UNKNOWN;  
             }
@@ -521,11 +495,11 @@ InputManager::AlgorithmSelection InputManager::selectAlgorithm(DataStructureEnum
         std::string input;
         switch (structureType) {
             case DataStructureEnum::LIST:
-                std::cout << "\nSelect algorithm (Insertion Sort, Merge Sort, Custom)" << std::endl;
+                std::cout << "\nSelect algorithm (Insertion Sort, Merge Sort, SIMD Sort, Radix Sort, Pdqsort, Std Sort, Sorting Network, External Merge Sort, K-Way Merge, Custom)" << std::endl;
                 std::cout << ">>> ";
                 break;
             case DataStructureEnum::HEAP:
-                std::cout << "\nSelect algorithm (Heap Build, Heap Selection, Custom)" << std::endl;
+                std::cout << "\nSelect algorithm (Heap Build, Heap Selection, Quickselect, SIMD Selection, Streaming Selection, Parallel Selection, Custom)" << std::endl;
                 std::cout << ">>> ";
                 break;
             case DataStructureEnum::GRAPH:
@@ -572,7 +546,8 @@ InputManager::AlgorithmSelection InputManager::selectAlgorithm(DataStructureEnum
 
             if (!promptCustomAlgorithmPath(selection.customAlgorithmPath,
                                            selection.customAlgorithmCompileOutput,
-                                           selection.customAlgorithmLibraryPath)) {
+                                           selection.customAlgorithmLibraryPath,
+                                           selection.customAlgorithmBuild)) {
                 selection.shouldExit = true;
                 algorithm = AlgorithmEnum::UNKNOWN;
             }
@@ -589,11 +564,22 @@ bool InputManager::isAlgorithmCompatible(AlgorithmEnum algorithm, DataStructureE
         case DataStructureEnum::LIST:
             return algorithm == AlgorithmEnum::INSERTION_SORT ||
                    algorithm == AlgorithmEnum::MERGE_SORT    ||
+                   algorithm == AlgorithmEnum::SIMD_SORT     ||
+                   algorithm == AlgorithmEnum::RADIX_SORT    ||
+                   algorithm == AlgorithmEnum::STD_SORT      ||
+                   algorithm == AlgorithmEnum::PDQ_SORT      ||
+                   algorithm == AlgorithmEnum::SORTING_NETWORK ||
+                   algorithm == AlgorithmEnum::EXTERNAL_MERGE_SORT ||
+                   algorithm == AlgorithmEnum::KWAY_MERGE ||
                    algorithm == AlgorithmEnum::CUSTOM;
 
         case DataStructureEnum::HEAP:
             return algorithm == AlgorithmEnum::HEAP_BUILD     ||
                    algorithm == AlgorithmEnum::HEAP_SELECTION ||
+                   algorithm == AlgorithmEnum::QUICK_SELECT   ||
+                   algorithm == AlgorithmEnum::SIMD_SELECTION ||
+                   algorithm == AlgorithmEnum::STREAMING_SELECTION ||
+                   algorithm == AlgorithmEnum::PARALLEL_SELECTION ||
                    algorithm == AlgorithmEnum::CUSTOM;
 
         case DataStructureEnum::GRAPH:
@@ -621,6 +607,11 @@ Algorithm* InputManager::createAlgorithm(const AlgorithmSelection& selection) co
     return AlgorithmFactory::createAlgorithm(selection.selectedAlgorithm, selection.customAlgorithmLibraryPath);
 }
 
+// Getter for the plugin compiler settings.
+const PluginCompiler& InputManager::getPluginCompiler() const {
+    return pluginCompiler;
+}
+
 // Handles the interactive element entry flow for each structure type.
 bool InputManager::populateDS(DataStructure* ds, DataStructureEnum structureType) {
     bool shouldExit = false;
@@ -0,0 +1,153 @@
+// src/manager/PgoPipeline.cpp
+#include "../../include/manager/PgoPipeline.hpp"
+#include "../../include/algorithm/AlgorithmFactory.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+
+// Namespace alias for filesystem
+namespace fs = std::filesystem;
+
+// Namespace for internal linkage
+namespace {
+// Number of .gcda files below the profile directory.
+std::size_t countProfileFiles(const fs::path& directory) {
+    std::size_t count = 0;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() == ".gcda") {
+            ++count;
+        }
+    }
+    return count;
+}
+
+// Loads a plugin through the same dlopen path as the interactive benchmark.
+std::unique_ptr<Algorithm> loadPlugin(const PluginBuild& build) {
+    return std::unique_ptr<Algorithm>(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, build.libraryPath));
+}
+
+// Loads one build on its own, keeps its best single run and unloads it again; false when it will not load.
+bool timeBuild(const PluginBuild& build, DataStructure* benchmark, BenchmarkManager& benchmarkManager, int repetitions,
+               double& bestMs) {
+    std::unique_ptr<Algorithm> algo = loadPlugin(build);
+    if (algo) {
+        for (int run = 0; run < repetitions; ++run) {
+            const double ms = benchmarkManager.timeExecution(benchmark, algo.get(), 1);
+            bestMs = run == 0 ? ms : std::min(bestMs, ms);
+        }
+    }
+    const bool loaded = algo != nullptr;
+    algo.reset();
+    AlgorithmFactory::unloadCustomLibrary(build.libraryPath);
+    return loaded;
+}
+} // namespace
+
+// Zero when either time is missing.
+double PgoComparison::speedup() const {
+    return optimisedMs > 0.0 ? baselineMs / optimisedMs : 0.0;
+}
+
+// A temporary directory keeps concurrent pipelines from sharing profile data.
+PgoPipeline::PgoPipeline(const PluginCompiler& baseCompiler, const std::string& directory)
+    : compiler(baseCompiler), workDirectory(directory) {
+    compiler.setProfileGuidance(PluginCompiler::ProfileGuidance::NONE, "");
+    if (workDirectory.empty()) {
+        std::random_device random;
+        workDirectory = (fs::temp_directory_path() / ("raystruct_pgo_" + std::to_string(random()))).string();
+    }
+}
+
+// Setter for the repetition count (at least one).
+void PgoPipeline::setRepetitions(int count) {
+    repetitions = std::max(1, count);
+}
+
+// The instrumented library has to be unloaded before the second build: its counters are only written
+// to disk by the library's destructors. Both PGO builds share one output path because GCC names the
+// .gcda files after it, and a -fprofile-use build that still warns about a missing profile was not
+// guided by the training run, so it stops the comparison.
+PgoComparison PgoPipeline::run(const std::string& sourcePath, DataStructure* training, DataStructure* benchmark,
+                               BenchmarkManager& benchmarkManager) {
+    PgoComparison result;
+    const fs::path root(workDirectory);
+    const fs::path profileDirectory = root / "profile";
+    const fs::path buildDirectory = root / "build";
+    std::error_code ec;
+    fs::remove_all(root, ec);
+
+    auto finish = [&](const std::string& message) {
+        result.message = message;
+        fs::remove_all(root, ec);
+        if (!message.empty()) {
+            std::cout << "\nPGO comparison stopped: " << message << std::endl;
+        }
+        return result;
+    };
+
+    // 1. Instrumented build and training run
+    PluginCompiler generate = compiler;
+    generate.setProfileGuidance(PluginCompiler::ProfileGuidance::GENERATE, fs::absolute(profileDirectory).string());
+    result.instrumented = generate.compile(sourcePath, buildDirectory.string());
+    if (!result.instrumented.succeeded) {
+        return finish("instrumented build failed:\n" + result.instrumented.compilerOutput);
+    }
+    {
+        std::unique_ptr<Algorithm> trainee = loadPlugin(result.instrumented);
+        if (!trainee) {
+            return finish("could not load the instrumented build");
+        }
+        result.trainingMs = benchmarkManager.timeExecution(training, trainee.get(), 1);
+    }
+    AlgorithmFactory::unloadCustomLibrary(result.instrumented.libraryPath);
+
+    result.profileFiles = countProfileFiles(profileDirectory);
+    if (result.profileFiles == 0) {
+        return finish("the training run wrote no profile data");
+    }
+
+    // 2. Optimised build from the profile, and the plain build it is compared against
+    PluginCompiler use = compiler;
+    use.setProfileGuidance(PluginCompiler::ProfileGuidance::USE, fs::absolute(profileDirectory).string());
+    result.optimised = use.compile(sourcePath, buildDirectory.string());
+    if (!result.optimised.succeeded) {
+        return finish("profile-guided build failed:\n" + result.optimised.compilerOutput);
+    }
+    if (result.optimised.compilerOutput.find("-Wmissing-profile") != std::string::npos) {
+        return finish("the profile-guided build found no profile for the plugin:\n" + result.optimised.compilerOutput);
+    }
+    result.baseline = compiler.compile(sourcePath, (root / "baseline").string());
+    if (!result.baseline.succeeded) {
+        return finish("baseline build failed:\n" + result.baseline.compilerOutput);
+    }
+
+    // 3. One build loaded at a time, so neither can share code or cache state with the other
+    if (!timeBuild(result.baseline, benchmark, benchmarkManager, repetitions, result.baselineMs)) {
+        return finish("could not load the plain build");
+    }
+    if (!timeBuild(result.optimised, benchmark, benchmarkManager, repetitions, result.optimisedMs)) {
+        return finish("could not load the profile-guided build");
+    }
+    result.succeeded = true;
+
+    std::cout << "\nProfile-guided optimisation: " << fs::path(sourcePath).filename().string() << " ("
+              << PluginCompiler::profileName(compiler.getProfile()) << ", trained on "
+              << (training == benchmark ? "the benchmark input, " : "a separate input of ") << training->getElements().size()
+              << " elements in " << result.trainingMs << " ms, " << result.profileFiles << " profile file(s))\n";
+    std::cout << std::left << std::setw(14) << "Build" << std::right << std::setw(12) << "Time (ms)"
+              << std::setw(12) << "Speedup" << "\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(14) << "plain" << std::right << std::setw(12) << result.baselineMs
+              << std::setw(11) << 1.0 << "x\n";
+    std::cout << std::left << std::setw(14) << "PGO" << std::right << std::setw(12) << result.optimisedMs
+              << std::setw(11) << result.speedup() << "x\n";
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6) << "(best of " << repetitions << " runs on " << benchmark->getElements().size()
+              << " elements)" << std::endl;
+
+    return finish("");
+}
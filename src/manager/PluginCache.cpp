@@ -0,0 +1,207 @@
+// src/manager/PluginCache.cpp
+#include "../../include/manager/PluginCache.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+// Namespace alias for filesystem
+namespace fs = std::filesystem;
+
+// Namespace for internal linkage
+namespace {
+// 64-bit FNV prime.
+constexpr std::uint64_t kFnvPrime = 1099511628211ull;
+
+// Whole file as a string; empty when it cannot be read.
+std::string readFile(const fs::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// Target of an `#include "name"` line, or an empty string for any other line.
+std::string quotedInclude(const std::string& line) {
+    std::size_t pos = line.find_first_not_of(" \t");
+    if (pos == std::string::npos || line[pos] != '#') return "";
+    pos = line.find_first_not_of(" \t", pos + 1);
+    if (pos == std::string::npos || line.compare(pos, 7, "include") != 0) return "";
+    const std::size_t open = line.find('"', pos + 7);
+    if (open == std::string::npos) return "";
+    const std::size_t close = line.find('"', open + 1);
+    return close == std::string::npos ? "" : line.substr(open + 1, close - open - 1);
+}
+
+// Adds the file and its quoted includes to the hash, visiting each header once.
+void hashFile(const fs::path& path, const std::vector<std::string>& includeDirectories,
+              std::set<fs::path>& visited, std::uint64_t& hash) {
+    std::error_code ec;
+    const fs::path canonical = fs::weakly_canonical(path, ec);
+    if (!visited.insert(ec ? path : canonical).second) {
+        return;
+    }
+
+    const std::string contents = readFile(path);
+    hash = PluginCache::fnv1a(path.filename().string() + "\n" + contents, hash);
+
+    std::istringstream lines(contents);
+    std::string line;
+    while (std::getline(lines, line)) {
+        const std::string name = quotedInclude(line);
+        if (name.empty()) continue;
+
+        // Same search order as the compiler: the including file's directory, then each -I
+        fs::path found = path.parent_path() / name;
+        if (!fs::exists(found, ec)) {
+            found.clear();
+            for (const std::string& directory : includeDirectories) {
+                fs::path candidate = fs::path(directory) / name;
+                if (fs::exists(candidate, ec)) {
+                    found = candidate;
+                    break;
+                }
+            }
+        }
+        if (found.empty()) {
+            // An unresolved header still changes the key if the directive changes
+            hash = PluginCache::fnv1a("missing:" + name, hash);
+            continue;
+        }
+        hashFile(found, includeDirectories, visited, hash);
+    }
+}
+} // namespace
+
+// Falls back to the default location for an empty path.
+PluginCache::PluginCache(const std::string& cacheDirectory)
+    : directory(cacheDirectory.empty() ? defaultDirectory() : cacheDirectory) {}
+
+// Getter for the cache directory.
+const std::string& PluginCache::getDirectory() const {
+    return directory;
+}
+
+// Tries to create the directory and checks the result.
+bool PluginCache::isUsable() const {
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    return fs::is_directory(directory, ec);
+}
+
+// Hex key in the file name keeps entries of different builds side by side.
+std::string PluginCache::entryPath(const std::string& stem, std::uint64_t key) const {
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(key));
+    return (fs::path(directory) / (stem + "_" + hex + "_custom.so")).string();
+}
+
+// Removes the shared objects and their logs, and whole subdirectories: the pgo/ builds and the scratch
+// directories of builds that were interrupted before their rename. The listing is taken first, so
+// nothing is removed under a live iterator.
+std::size_t PluginCache::clear() const {
+    std::vector<fs::path> entries;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        entries.push_back(entry.path());
+    }
+
+    std::size_t removed = 0;
+    for (const fs::path& entry : entries) {
+        const std::uintmax_t count = fs::remove_all(entry, ec);
+        if (!ec && count != static_cast<std::uintmax_t>(-1)) {
+            removed += static_cast<std::size_t>(count);
+        }
+    }
+    return removed;
+}
+
+// Follows the XDG convention so the cache sits next to other tools' caches.
+std::string PluginCache::defaultDirectory() {
+    if (const char* overridden = std::getenv("RAYSTRUCT_CACHE_DIR")) {
+        if (*overridden) return overridden;
+    }
+    if (const char* xdg = std::getenv("XDG_CACHE_HOME")) {
+        if (*xdg) return (fs::path(xdg) / "raystruct").string();
+    }
+    if (const char* home = std::getenv("HOME")) {
+        if (*home) return (fs::path(home) / ".cache" / "raystruct").string();
+    }
+    return (fs::temp_directory_path() / "raystruct_cache").string();
+}
+
+// XOR the byte in, then multiply by the prime.
+std::uint64_t PluginCache::fnv1a(const std::string& data, std::uint64_t seed) {
+    std::uint64_t hash = seed;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
+// Walks the include graph starting at the source.
+std::uint64_t PluginCache::hashSource(const std::string& sourcePath, const std::vector<std::string>& includeDirectories) {
+    std::error_code ec;
+    if (!fs::is_regular_file(sourcePath, ec)) {
+        return 0;
+    }
+    std::set<fs::path> visited;
+    std::uint64_t hash = fnv1a("");
+    hashFile(sourcePath, includeDirectories, visited, hash);
+    return hash;
+}
+
+// Spawning the compiler costs a few milliseconds, so the answer is remembered.
+std::string PluginCache::compilerIdentity(const std::string& compiler) {
+    static std::mutex mutex;
+    static std::map<std::string, std::string> identities;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = identities.find(compiler);
+    if (it != identities.end()) {
+        return it->second;
+    }
+
+    std::string identity = compiler;
+#if defined(_WIN32)
+    FILE* pipe = _popen((compiler + " --version 2>&1").c_str(), "r");
+#else
+    FILE* pipe = popen((compiler + " --version 2>&1").c_str(), "r");
+#endif
+    if (pipe) {
+        char buffer[256];
+        while (std::fgets(buffer, sizeof(buffer), pipe)) {
+            identity += buffer;
+        }
+#if defined(_WIN32)
+        _pclose(pipe);
+#else
+        pclose(pipe);
+#endif
+    }
+    identities.emplace(compiler, identity);
+    return identity;
+}
+
+// The first "model name" and "flags" lines of /proc/cpuinfo; empty elsewhere.
+std::string PluginCache::cpuSignature() {
+    std::string signature;
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    bool haveModel = false, haveFlags = false;
+    while (std::getline(cpuinfo, line) && !(haveModel && haveFlags)) {
+        if (!haveModel && line.rfind("model name", 0) == 0) {
+            signature += line + "\n";
+            haveModel = true;
+        } else if (!haveFlags && line.rfind("flags", 0) == 0) {
+            signature += line + "\n";
+            haveFlags = true;
+        }
+    }
+    return signature;
+}
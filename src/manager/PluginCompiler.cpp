@@ -0,0 +1,305 @@
+// src/manager/PluginCompiler.cpp
+#include "../../include/manager/PluginCompiler.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+// Namespace alias for filesystem
+namespace fs = std::filesystem;
+
+// Namespace for internal linkage
+namespace {
+// Flags every plugin is built with, whatever the profile. -Bsymbolic binds the library's references to its
+// own definitions, so inline functions it shares with the program or another plugin never interpose.
+const char* const kBaseFlags = "-std=c++17 -shared -fPIC -Wall -Wextra"
+#if defined(__linux__)
+                               " -Wl,-Bsymbolic"
+#endif
+    ;
+
+// Root of the project, whose include and src directories plugins compile against.
+fs::path projectRoot() {
+    std::error_code ec;
+    const fs::path file = fs::absolute(fs::path(__FILE__), ec);
+    return (ec ? fs::path(__FILE__) : file).parent_path().parent_path().parent_path();
+}
+
+// Stem of the source reduced to characters that are safe in a file name.
+std::string sanitizedStem(const std::string& sourcePath) {
+    std::string stem = fs::path(sourcePath).stem().string();
+    if (stem.empty()) {
+        stem = "custom_plugin";
+    }
+    std::replace_if(stem.begin(), stem.end(), [](unsigned char c) {
+        return !std::isalnum(c) && c != '_';
+    }, '_');
+    return stem;
+}
+
+// File-name tag of a profile. Custom flags are hashed into it, like the cache key, so two flag sets never
+// share a library; the PGO additions are left out because both stages must build the same file.
+std::string profileTag(BuildProfile profile, const std::string& customFlags) {
+    char hex[9];
+    switch (profile) {
+        case BuildProfile::DEBUG: return "debug";
+        case BuildProfile::O3_NATIVE: return "o3native";
+        case BuildProfile::LTO: return "lto";
+        case BuildProfile::CUSTOM:
+            std::snprintf(hex, sizeof(hex), "%08llx", static_cast<unsigned long long>(PluginCache::fnv1a(customFlags) & 0xffffffffull));
+            return std::string("flags") + hex;
+        case BuildProfile::O2:
+        default: return "o2";
+    }
+}
+} // namespace
+
+// Profile label followed by the exact flags.
+std::string PluginBuild::describe() const {
+    return compiler + " " + PluginCompiler::profileName(profile) + " (" + (flags.empty() ? "no optimisation flags" : flags) + ")";
+}
+
+// Only a bare executable name or path is accepted, since it starts the shell command.
+bool PluginCompiler::setCompiler(const std::string& executable) {
+    if (executable.empty() || executable.find_first_of(" \t;|&`$<>\\\"'\n") != std::string::npos) {
+        return false;
+    }
+    compiler = executable;
+    return true;
+}
+
+// Getter for the compiler executable.
+const std::string& PluginCompiler::getCompiler() const {
+    return compiler;
+}
+
+// Setter for the profile.
+void PluginCompiler::setProfile(BuildProfile newProfile) {
+    profile = newProfile;
+}
+
+// Getter for the profile.
+BuildProfile PluginCompiler::getProfile() const {
+    return profile;
+}
+
+// The flags end up in a std::system command line, so anything the shell would interpret is refused.
+bool PluginCompiler::setCustomFlags(const std::string& flags) {
+    if (flags.find_first_of(";|&`$<>\\\"'\n") != std::string::npos) {
+        return false;
+    }
+    customFlags = flags;
+    return true;
+}
+
+// Setter for the PGO stage and its data directory.
+void PluginCompiler::setProfileGuidance(ProfileGuidance stage, const std::string& directory) {
+    guidance = stage;
+    profileDirectory = directory;
+}
+
+// Getter for the PGO stage.
+PluginCompiler::ProfileGuidance PluginCompiler::getProfileGuidance() const {
+    return guidance;
+}
+
+// Debug keeps -O0 on purpose (with symbols), which used to be what every plugin got silently.
+// Instrumented counters are updated atomically because plugins may run on the thread pool.
+std::string PluginCompiler::profileFlags() const {
+    std::string flags;
+    switch (profile) {
+        case BuildProfile::DEBUG: flags = "-O0 -g"; break;
+        case BuildProfile::O3_NATIVE: flags = "-O3 -march=native"; break;
+        case BuildProfile::LTO: flags = "-O3 -march=native -flto"; break;
+        case BuildProfile::CUSTOM: flags = customFlags; break;
+        case BuildProfile::O2:
+        default: flags = "-O2"; break;
+    }
+
+    const std::string separator = flags.empty() ? "" : " ";
+    if (guidance == ProfileGuidance::GENERATE) {
+        flags += separator + "-fprofile-generate=\"" + profileDirectory + "\" -fprofile-update=atomic";
+    } else if (guidance == ProfileGuidance::USE) {
+        flags += separator + "-fprofile-use=\"" + profileDirectory + "\" -fprofile-correction";
+    }
+    return flags;
+}
+
+// Runs the compiler with its output captured in a log next to the library.
+PluginBuild PluginCompiler::compile(const std::string& sourcePath, const std::string& outputDirectory) const {
+    PluginBuild build;
+    build.compiler = compiler;
+    build.profile = profile;
+    build.flags = profileFlags();
+
+    const fs::path root = projectRoot();
+    std::error_code ec;
+    fs::create_directories(outputDirectory, ec);
+
+    fs::path libraryFile = fs::path(outputDirectory) / (sanitizedStem(sourcePath) + "_" + profileTag(profile, customFlags) + "_custom.so");
+    fs::path logPath = libraryFile;
+    logPath += ".log";
+    fs::remove(libraryFile, ec);
+
+    std::ostringstream command;
+    command << compiler << " " << kBaseFlags;
+    if (!build.flags.empty()) {
+        command << " " << build.flags;
+    }
+    command << " -I\"" << (root / "include").string() << "\""
+            << " -I\"" << (root / "src").string() << "\""
+            << " \"" << sourcePath << "\""
+            << " -o \"" << libraryFile.string() << "\"";
+    build.command = command.str();
+
+    const int result = std::system((build.command + " >\"" + logPath.string() + "\" 2>&1").c_str());
+
+    {
+        std::ifstream logStream(logPath);
+        if (logStream.is_open()) {
+            std::ostringstream oss;
+            oss << logStream.rdbuf();
+            build.compilerOutput = oss.str();
+        }
+    }
+    fs::remove(logPath, ec);
+
+    if (result != 0) {
+        fs::remove(libraryFile, ec);
+        return build;
+    }
+
+    build.succeeded = true;
+    build.libraryPath = libraryFile.string();
+    return build;
+}
+
+// A hit skips the compiler; a miss compiles into a scratch directory inside the cache and renames the
+// result (and its log) to the entry name.
+PluginBuild PluginCompiler::compile(const std::string& sourcePath, const PluginCache& cache) const {
+    if (guidance != ProfileGuidance::NONE) {
+        return compile(sourcePath, (fs::path(cache.getDirectory()) / "pgo").string());
+    }
+
+    const std::uint64_t key = cacheKey(sourcePath);
+    const fs::path entry = cache.entryPath(sanitizedStem(sourcePath), key);
+    fs::path logPath = entry;
+    logPath += ".log";
+
+    std::error_code ec;
+    if (fs::is_regular_file(entry, ec)) {
+        PluginBuild build;
+        build.succeeded = true;
+        build.fromCache = true;
+        build.cacheKey = key;
+        build.compiler = compiler;
+        build.profile = profile;
+        build.flags = profileFlags();
+        build.libraryPath = entry.string();
+        std::ifstream log(logPath);
+        std::getline(log, build.command);
+        std::ostringstream rest;
+        rest << log.rdbuf();
+        build.compilerOutput = rest.str();
+        return build;
+    }
+
+    std::random_device random;
+    const fs::path scratch = fs::path(cache.getDirectory()) / ("build-" + std::to_string(random()) + std::to_string(random()));
+    PluginBuild build = compile(sourcePath, scratch.string());
+    build.cacheKey = key;
+    if (build.succeeded) {
+        {
+            std::ofstream log(fs::path(scratch) / "build.log");
+            log << build.command << "\n" << build.compilerOutput;
+        }
+        fs::rename(fs::path(scratch) / "build.log", logPath, ec);
+        fs::rename(build.libraryPath, entry, ec);
+        if (ec) {
+            build.succeeded = false;
+            build.compilerOutput += "\nCould not store the plugin in the cache: " + ec.message();
+        } else {
+            build.libraryPath = entry.string();
+        }
+    }
+    fs::remove_all(scratch, ec);
+    return build;
+}
+
+// Source and header contents, compiler version, flags, and the CPU for -march=native builds.
+std::uint64_t PluginCompiler::cacheKey(const std::string& sourcePath) const {
+    const fs::path root = projectRoot();
+    const std::uint64_t sourceHash = PluginCache::hashSource(sourcePath, {(root / "include").string(), (root / "src").string()});
+
+    const std::string flags = profileFlags();
+    std::string configuration = std::to_string(sourceHash) + "\n" + PluginCache::compilerIdentity(compiler) + "\n" +
+                                kBaseFlags + " " + flags + "\n";
+    if (flags.find("native") != std::string::npos) {
+        configuration += PluginCache::cpuSignature();
+    }
+    return PluginCache::fnv1a(configuration);
+}
+
+// Probes the executable without compiling anything.
+bool PluginCompiler::isCompilerAvailable(const std::string& executable) {
+    PluginCompiler probe;
+    if (!probe.setCompiler(executable)) {
+        return false;
+    }
+#if defined(_WIN32)
+    return std::system((executable + " --version >nul 2>&1").c_str()) == 0;
+#else
+    return std::system((executable + " --version >/dev/null 2>&1").c_str()) == 0;
+#endif
+}
+
+// Label used in menus and benchmark headers.
+std::string PluginCompiler::profileName(BuildProfile profile) {
+    switch (profile) {
+        case BuildProfile::DEBUG: return "debug";
+        case BuildProfile::O3_NATIVE: return "O3 + native";
+        case BuildProfile::LTO: return "LTO";
+        case BuildProfile::CUSTOM: return "custom";
+        case BuildProfile::O2:
+        default: return "O2";
+    }
+}
+
+// Accepts the menu names and a few obvious spellings.
+bool PluginCompiler::parseProfile(const std::string& text, BuildProfile& profile) {
+    std::string s = text;
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    if (s == "debug" || s == "o0") profile = BuildProfile::DEBUG;
+    else if (s == "o2" || s == "release") profile = BuildProfile::O2;
+    else if (s == "o3" || s == "native" || s == "o3 + native") profile = BuildProfile::O3_NATIVE;
+    else if (s == "lto") profile = BuildProfile::LTO;
+    else if (s == "custom" || s == "flags") profile = BuildProfile::CUSTOM;
+    else return false;
+    return true;
+}
+
+// GCC and Clang only say whether optimisation is on, not the level, so that is what gets reported.
+std::string PluginCompiler::hostBuildDescription() {
+    std::string description = "built-in code (";
+#if defined(__OPTIMIZE__)
+    description += "optimised";
+#else
+    description += "unoptimised";
+#endif
+#if defined(__AVX2__)
+    description += ", AVX2";
+#elif defined(__SSE4_2__)
+    description += ", SSE4.2";
+#endif
+#if defined(__clang__)
+    description += ", clang " + std::to_string(__clang_major__);
+#elif defined(__GNUC__)
+    description += ", g++ " + std::to_string(__GNUC__);
+#endif
+    return description + ")";
+}
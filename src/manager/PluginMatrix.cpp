@@ -0,0 +1,197 @@
+// src/manager/PluginMatrix.cpp
+#include "../../include/manager/PluginMatrix.hpp"
+#include "../../include/algorithm/AlgorithmFactory.hpp"
+#include "../../include/core/WorkStealingThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+
+// Namespace alias for filesystem
+namespace fs = std::filesystem;
+
+// Namespace for internal linkage
+namespace {
+// Compiler configured for one variant.
+PluginCompiler compilerFor(const PluginVariant& variant) {
+    PluginCompiler compiler;
+    compiler.setCompiler(variant.compiler);
+    compiler.setProfile(variant.profile);
+    compiler.setCustomFlags(variant.customFlags);
+    return compiler;
+}
+} // namespace
+
+// Custom flag sets are shown as the flags themselves.
+std::string PluginVariant::label() const {
+    if (profile == BuildProfile::CUSTOM) {
+        return compiler + " " + (customFlags.empty() ? "(no flags)" : customFlags);
+    }
+    return compiler + " " + PluginCompiler::profileName(profile);
+}
+
+// Runs the same checks the compiler itself applies.
+bool PluginMatrix::addVariant(const PluginVariant& variant) {
+    PluginCompiler probe;
+    if (!probe.setCompiler(variant.compiler) || !probe.setCustomFlags(variant.customFlags)) {
+        return false;
+    }
+    variants.push_back(variant);
+    return true;
+}
+
+// Getter for the variants.
+const std::vector<PluginVariant>& PluginMatrix::getVariants() const {
+    return variants;
+}
+
+// Stores the repetition count (at least one).
+void PluginMatrix::setRepetitions(int count) {
+    repetitions = std::max(1, count);
+}
+
+// Setter for the cache location.
+void PluginMatrix::setCacheDirectory(const std::string& directory) {
+    cacheDirectory = directory;
+}
+
+// Setter for the optional scheduler.
+void PluginMatrix::setScheduler(const BenchmarkScheduler* batchScheduler) {
+    scheduler = batchScheduler;
+}
+
+// clang++ is optional, so it is probed first.
+void PluginMatrix::addStandardVariants() {
+    for (const char* compiler : {"g++", "clang++"}) {
+        if (!PluginCompiler::isCompilerAvailable(compiler)) {
+            continue;
+        }
+        addVariant(PluginVariant{compiler, BuildProfile::O2, ""});
+        addVariant(PluginVariant{compiler, BuildProfile::O3_NATIVE, ""});
+    }
+}
+
+// The cache key covers the compiler identity, so variants never collide on a library path. Without a
+// usable cache every variant gets its own temporary directory for the same reason.
+std::vector<PluginVariantResult> PluginMatrix::run(const std::string& sourcePath, DataStructure* ds,
+                                                   BenchmarkManager& benchmarkManager) const {
+    std::vector<PluginVariantResult> results(variants.size());
+    const PluginCache cache(cacheDirectory);
+    const bool cached = cache.isUsable();
+    std::random_device random;
+    const fs::path scratch = fs::temp_directory_path() / ("raystruct_matrix_" + std::to_string(random()));
+
+    // The compilers are separate processes, so tasks mostly wait on them: a pool of its own runs every
+    // build at once without tying up (or being limited by) the shared pool's workers
+    WorkStealingThreadPool buildPool(static_cast<unsigned>(variants.size()));
+    buildPool.runTasks(static_cast<unsigned>(variants.size()), [&](unsigned v) {
+        PluginVariantResult& result = results[v];
+        result.variant = variants[v];
+        const PluginCompiler compiler = compilerFor(variants[v]);
+
+        auto start = std::chrono::steady_clock::now();
+        result.build = cached ? compiler.compile(sourcePath, cache)
+                              : compiler.compile(sourcePath, (scratch / std::to_string(v)).string());
+        result.buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    });
+
+    // Without a scheduler each variant is unloaded before the next one is loaded; with one, all of them
+    // stay loaded for the batch. Libraries the session already held are never unloaded here.
+    std::vector<std::unique_ptr<Algorithm>> instances;
+    std::vector<std::string> unloadAfterwards;
+    std::vector<BenchmarkScenario> scenarios;
+    std::vector<std::size_t> scenarioResults;
+    for (std::size_t v = 0; v < results.size(); ++v) {
+        PluginVariantResult& result = results[v];
+        if (!result.build.succeeded) {
+            continue;
+        }
+        const bool heldBySession = AlgorithmFactory::isCustomLibraryLoaded(result.build.libraryPath);
+        std::unique_ptr<Algorithm> algo(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, result.build.libraryPath));
+        if (algo) {
+            result.loaded = true;
+            result.algorithmName = algo->getName();
+            if (scheduler) {
+                scenarios.push_back(BenchmarkScenario{result.variant.label(), ds, algo.get(), repetitions, false});
+                scenarioResults.push_back(v);
+                instances.push_back(std::move(algo));
+            } else {
+                result.sample = benchmarkManager.sampleExecution(ds, algo.get(), repetitions);
+            }
+        }
+        if (!heldBySession) {
+            unloadAfterwards.push_back(result.build.libraryPath);
+        }
+        if (!scheduler) {
+            algo.reset();
+            for (const std::string& path : unloadAfterwards) {
+                AlgorithmFactory::unloadCustomLibrary(path);
+            }
+            unloadAfterwards.clear();
+        }
+    }
+    if (scheduler) {
+        const std::vector<ScheduledRun> runs = scheduler->run(scenarios);
+        for (std::size_t i = 0; i < runs.size(); ++i) {
+            results[scenarioResults[i]].sample = runs[i].sample;
+        }
+        instances.clear();
+        for (const std::string& path : unloadAfterwards) {
+            AlgorithmFactory::unloadCustomLibrary(path);
+        }
+    }
+
+    // Baseline for the relative column: the first variant that ran
+    double baselineMs = 0.0;
+    for (const PluginVariantResult& result : results) {
+        if (result.loaded && result.sample.completed) {
+            baselineMs = result.sample.bestMs;
+            break;
+        }
+    }
+
+    std::cout << "\nCompiler matrix: " << fs::path(sourcePath).filename().string() << " on " << ds->getElements().size()
+              << " elements (best of " << repetitions << ", counters summed over all runs)\n";
+    std::cout << std::left << std::setw(28) << "Variant" << std::right << std::setw(11) << "Build (ms)"
+              << std::setw(11) << "Best (ms)" << std::setw(11) << "Mean (ms)" << std::setw(9) << "Rel."
+              << std::setw(11) << "User (ms)" << std::setw(10) << "Min flt" << std::setw(9) << "Ctx sw" << "\n";
+    std::cout << std::fixed;
+    for (const PluginVariantResult& result : results) {
+        std::cout << std::left << std::setw(28) << result.variant.label() << std::right << std::setprecision(0)
+                  << std::setw(11) << result.buildMs;
+        if (!result.build.succeeded) {
+            std::cout << "  build failed\n";
+            continue;
+        }
+        if (!result.loaded) {
+            std::cout << "  load failed\n";
+            continue;
+        }
+        const ExecutionSample& sample = result.sample;
+        if (!sample.completed) {
+            std::cout << "  " << sample.failure << "\n";
+            continue;
+        }
+        std::cout << std::setprecision(3) << std::setw(11) << sample.bestMs << std::setw(11) << sample.meanMs
+                  << std::setprecision(2) << std::setw(8) << (sample.bestMs > 0.0 ? baselineMs / sample.bestMs : 0.0) << "x"
+                  << std::setprecision(1) << std::setw(11) << sample.userMs << std::setw(10) << sample.minorFaults
+                  << std::setw(9) << sample.voluntarySwitches + sample.involuntarySwitches
+                  << (result.build.fromCache ? "  (cached)" : "") << "\n";
+    }
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6);
+
+    for (const PluginVariantResult& result : results) {
+        if (!result.build.succeeded) {
+            std::cout << "\n" << result.variant.label() << " failed to build:\n" << result.build.compilerOutput;
+        }
+    }
+    std::cout << std::flush;
+
+    std::error_code ec;
+    fs::remove_all(scratch, ec);
+    return results;
+}
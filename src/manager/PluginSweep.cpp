@@ -0,0 +1,144 @@
+// src/manager/PluginSweep.cpp
+#include "../../include/manager/PluginSweep.hpp"
+#include "../../include/algorithm/AlgorithmFactory.hpp"
+#include "../../include/structure/DataStructureFactory.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+// Namespace for internal linkage
+namespace {
+// Fresh instance of one algorithm entry; an unnamed entry stands for the library's default factory.
+std::unique_ptr<Algorithm> createEntry(const std::string& library, const RegisteredEntry& entry) {
+    if (entry.name.empty()) {
+        return std::unique_ptr<Algorithm>(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, library));
+    }
+    return std::unique_ptr<Algorithm>(AlgorithmFactory::createCustomAlgorithm(library, entry.name));
+}
+} // namespace
+
+// Stores the repetition count (at least one).
+void PluginSweep::setRepetitions(int count) {
+    repetitions = std::max(1, count);
+}
+
+// Setter for the optional scheduler.
+void PluginSweep::setScheduler(const BenchmarkScheduler* batchScheduler) {
+    scheduler = batchScheduler;
+}
+
+// Stores the names as given; they are matched against the registered names.
+void PluginSweep::setSerialAlgorithms(const std::vector<std::string>& names) {
+    serialAlgorithms = names;
+}
+
+// Every pair is instantiated up front, so the scheduler can run them side by side; structures are the
+// outer loop so each one is filled once and the algorithms share it.
+std::vector<PluginSweepResult> PluginSweep::run(const std::string& algorithmLibrary, DataStructure* ds,
+                                                BenchmarkManager& benchmarkManager, const std::string& structureLibrary) const {
+    std::vector<PluginSweepResult> results;
+
+    std::vector<RegisteredEntry> algorithms;
+    if (!AlgorithmFactory::listCustomAlgorithms(algorithmLibrary, algorithms)) {
+        std::cout << "\nSweep skipped: the algorithm library could not be loaded." << std::endl;
+        return results;
+    }
+    if (algorithms.empty()) {
+        algorithms.push_back(RegisteredEntry{});
+    }
+
+    std::vector<RegisteredEntry> structures;
+    if (!structureLibrary.empty() && !DataStructureFactory::listCustomDataStructures(structureLibrary, structures)) {
+        std::cout << "\nSweep skipped: the structure library could not be loaded." << std::endl;
+        return results;
+    }
+
+    const std::vector<int> elements = ds->getElements();
+    const std::size_t structureCount = std::max<std::size_t>(1, structures.size());
+    std::vector<std::unique_ptr<DataStructure>> ownedStructures;
+    std::vector<std::unique_ptr<Algorithm>> instances;
+    std::vector<BenchmarkScenario> scenarios;
+    std::vector<std::size_t> scenarioResults;
+    for (std::size_t s = 0; s < structureCount; ++s) {
+        DataStructure* target = ds;
+        std::string structureLabel = ds->getName();
+        if (!structures.empty()) {
+            ownedStructures.emplace_back(DataStructureFactory::createCustomDataStructure(structureLibrary, structures[s].name));
+            structureLabel = structures[s].label();
+            if (ownedStructures.back()) {
+                for (int value : elements) {
+                    ownedStructures.back()->insert(value);
+                }
+            }
+            target = ownedStructures.back().get();
+        }
+
+        for (const RegisteredEntry& entry : algorithms) {
+            PluginSweepResult result;
+            result.structure = structureLabel;
+            result.algorithm = entry;
+            std::unique_ptr<Algorithm> algo = target ? createEntry(algorithmLibrary, entry) : nullptr;
+            if (algo) {
+                if (result.algorithm.name.empty()) {
+                    result.algorithm.name = algo->getName();
+                }
+                result.loaded = true;
+                const bool serial = std::find(serialAlgorithms.begin(), serialAlgorithms.end(), result.algorithm.name) !=
+                                    serialAlgorithms.end();
+                scenarios.push_back(BenchmarkScenario{result.structure + " / " + result.algorithm.label(), target, algo.get(),
+                                                      repetitions, serial});
+                scenarioResults.push_back(results.size());
+                instances.push_back(std::move(algo));
+            }
+            results.push_back(result);
+        }
+    }
+
+    if (scheduler) {
+        const std::vector<ScheduledRun> runs = scheduler->run(scenarios);
+        for (std::size_t i = 0; i < runs.size(); ++i) {
+            results[scenarioResults[i]].sample = runs[i].sample;
+        }
+    } else {
+        for (std::size_t i = 0; i < scenarios.size(); ++i) {
+            results[scenarioResults[i]].sample = benchmarkManager.sampleExecution(scenarios[i].ds, scenarios[i].algo, repetitions);
+        }
+    }
+    // The instances must be gone before their structures
+    instances.clear();
+
+    // Fastest first; pairs that failed to load or to finish go last
+    auto finished = [](const PluginSweepResult& result) { return result.loaded && result.sample.completed; };
+    std::stable_sort(results.begin(), results.end(), [&](const PluginSweepResult& a, const PluginSweepResult& b) {
+        if (finished(a) != finished(b)) {
+            return finished(a);
+        }
+        return finished(a) && a.sample.bestMs < b.sample.bestMs;
+    });
+    const double fastestMs = !results.empty() && finished(results.front()) ? results.front().sample.bestMs : 0.0;
+
+    std::cout << "\nPlugin sweep: " << std::filesystem::path(algorithmLibrary).filename().string() << ", "
+              << algorithms.size() << " algorithm(s) x " << structureCount << " structure(s) on " << elements.size()
+              << " elements (best of " << repetitions << ")\n";
+    std::cout << std::left << std::setw(24) << "Structure" << std::setw(40) << "Algorithm" << std::right
+              << std::setw(11) << "Best (ms)" << std::setw(11) << "Mean (ms)" << std::setw(10) << "vs best" << "\n";
+    std::cout << std::fixed;
+    for (const PluginSweepResult& result : results) {
+        std::cout << std::left << std::setw(24) << result.structure << std::setw(40) << result.algorithm.label() << std::right;
+        if (!result.loaded) {
+            std::cout << "  load failed\n";
+            continue;
+        }
+        if (!result.sample.completed) {
+            std::cout << "  " << result.sample.failure << "\n";
+            continue;
+        }
+        std::cout << std::setprecision(3) << std::setw(11) << result.sample.bestMs << std::setw(11) << result.sample.meanMs
+                  << std::setprecision(2) << std::setw(9) << (fastestMs > 0.0 ? result.sample.bestMs / fastestMs : 0.0) << "x\n";
+    }
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6) << std::flush;
+    return results;
+}
@@ -0,0 +1,270 @@
+// src/manager/PluginWatcher.cpp
+#include "../../include/manager/PluginWatcher.hpp"
+#include "../../include/algorithm/AlgorithmFactory.hpp"
+#include "../../include/manager/PluginCache.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Namespace alias for filesystem
+namespace fs = std::filesystem;
+
+// Namespace for internal linkage
+namespace {
+// Quiet time required after a change before rebuilding; editors often save in several writes.
+constexpr int kSettleMs = 150;
+// Longest single wait, so stop() and the modification-time fallback are checked regularly.
+constexpr int kTickMs = 200;
+
+// Why a wait returned.
+enum class WakeReason { CHANGED, STOP, TIMEOUT };
+
+// Last write time of the source, or the epoch while it is missing (e.g. mid-rename).
+fs::file_time_type writeTime(const fs::path& path) {
+    std::error_code ec;
+    fs::file_time_type time = fs::last_write_time(path, ec);
+    return ec ? fs::file_time_type{} : time;
+}
+
+// Consumes one line of input once the user pressed Enter.
+void consumeInputLine() {
+    std::string line;
+    std::getline(std::cin, line);
+}
+
+// Reports changes to one source file. The parent directory is watched rather than the file, because many
+// editors save by writing a new file and renaming it over the old one.
+class SourceMonitor {
+private:
+    fs::path source;
+    fs::file_time_type lastWrite;
+#if defined(__linux__)
+    int fd = -1;
+
+    // Reads every queued event; true when one of them names the source.
+    bool drainEvents() {
+        alignas(inotify_event) char buffer[4096];
+        bool matched = false;
+        const std::string name = source.filename().string();
+        while (true) {
+            const ssize_t length = read(fd, buffer, sizeof(buffer));
+            if (length <= 0) {
+                return matched;
+            }
+            for (ssize_t offset = 0; offset < length;) {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                if (event->len > 0 && name == event->name) {
+                    matched = true;
+                }
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+            }
+        }
+    }
+
+    // Keeps swallowing events until the directory has been quiet for kSettleMs.
+    void settle() {
+        pollfd watch{fd, POLLIN, 0};
+        while (poll(&watch, 1, kSettleMs) > 0) {
+            drainEvents();
+        }
+    }
+#endif
+
+public:
+    // Starts watching immediately so changes made during the first build are not missed.
+    explicit SourceMonitor(const fs::path& sourcePath) : source(fs::absolute(sourcePath)), lastWrite(writeTime(source)) {
+#if defined(__linux__)
+        fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd >= 0 && inotify_add_watch(fd, source.parent_path().c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+            close(fd);
+            fd = -1;
+        }
+#endif
+    }
+
+    SourceMonitor(const SourceMonitor&) = delete;
+    SourceMonitor& operator=(const SourceMonitor&) = delete;
+
+    // Releases the inotify descriptor.
+    ~SourceMonitor() {
+#if defined(__linux__)
+        if (fd >= 0) {
+            close(fd);
+        }
+#endif
+    }
+
+    // False when the monitor falls back to polling the modification time.
+    bool usesNotifications() const {
+#if defined(__linux__)
+        return fd >= 0;
+#else
+        return false;
+#endif
+    }
+
+    // Waits at most one tick for a change or, when watchInput is set, for a line on standard input.
+    WakeReason wait(bool watchInput) {
+#if defined(__linux__)
+        pollfd fds[2] = {{fd, POLLIN, 0}, {STDIN_FILENO, POLLIN, 0}};
+        pollfd* first = fd >= 0 ? &fds[0] : &fds[1];
+        const nfds_t count = static_cast<nfds_t>((fd >= 0 ? 1 : 0) + (watchInput ? 1 : 0));
+        if (count == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(kTickMs));
+        } else if (poll(first, count, kTickMs) > 0) {
+            if (watchInput && (fds[1].revents & (POLLIN | POLLHUP))) {
+                consumeInputLine();
+                return WakeReason::STOP;
+            }
+            if (fd >= 0 && (fds[0].revents & POLLIN) && drainEvents()) {
+                settle();
+                lastWrite = writeTime(source);
+                return WakeReason::CHANGED;
+            }
+        }
+        if (fd >= 0) {
+            return WakeReason::TIMEOUT;
+        }
+#else
+        (void)watchInput;
+        std::this_thread::sleep_for(std::chrono::milliseconds(kTickMs));
+#endif
+        const fs::file_time_type current = writeTime(source);
+        if (current == lastWrite || current == fs::file_time_type{}) {
+            return WakeReason::TIMEOUT;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(kSettleMs));
+        lastWrite = writeTime(source);
+        return WakeReason::CHANGED;
+    }
+};
+} // namespace
+
+// Copies the compiler so later changes in the wizard do not affect a running watch.
+PluginWatcher::PluginWatcher(const PluginCompiler& pluginCompiler) : compiler(pluginCompiler) {}
+
+// Stores the repetition count (at least one).
+void PluginWatcher::setRepetitions(int count) {
+    repetitions = std::max(1, count);
+}
+
+// Setter for the cache location.
+void PluginWatcher::setCacheDirectory(const std::string& directory) {
+    cacheDirectory = directory;
+}
+
+// Enables the Enter key as a way out of the loop.
+void PluginWatcher::setStopOnEnter(bool enabled) {
+    stopOnEnter = enabled;
+}
+
+// Picked up at the next wake-up, within one tick.
+void PluginWatcher::stop() {
+    stopRequested = true;
+}
+
+// A failed build keeps the previous library loaded, so the next save is compared with the last good one.
+std::vector<WatchIteration> PluginWatcher::watch(const std::string& sourcePath, DataStructure* ds,
+                                                 BenchmarkManager& benchmarkManager, int maxBuilds) {
+    std::vector<WatchIteration> iterations;
+    stopRequested = false;
+    SourceMonitor monitor(sourcePath);
+
+    const PluginCache cache(cacheDirectory);
+    std::random_device random;
+    const fs::path scratch = fs::temp_directory_path() / ("raystruct_watch_" + std::to_string(random()));
+
+    // Libraries the interactive session already holds are reused but never unloaded here
+    std::unique_ptr<Algorithm> algo;
+    std::string loadedPath;
+    bool ownsLoaded = false;
+    auto release = [&]() {
+        algo.reset();
+        if (ownsLoaded) {
+            AlgorithmFactory::unloadCustomLibrary(loadedPath);
+        }
+        loadedPath.clear();
+        ownsLoaded = false;
+    };
+
+    double previousMs = 0.0;
+    int previousNumber = 0;
+    auto rebuild = [&]() {
+        WatchIteration iteration;
+        iteration.number = static_cast<int>(iterations.size()) + 1;
+        iteration.build = cache.isUsable() ? compiler.compile(sourcePath, cache)
+                                           : compiler.compile(sourcePath, (scratch / std::to_string(iteration.number)).string());
+        if (!iteration.build.succeeded) {
+            std::cout << "[Watch] build " << iteration.number << " failed; keeping the previous library:\n"
+                      << iteration.build.compilerOutput << std::endl;
+            iterations.push_back(iteration);
+            return;
+        }
+
+        // The old instance has to be gone before its library is closed
+        release();
+        loadedPath = iteration.build.libraryPath;
+        ownsLoaded = !AlgorithmFactory::isCustomLibraryLoaded(loadedPath);
+        algo.reset(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, loadedPath));
+        if (!algo) {
+            std::cout << "[Watch] build " << iteration.number << " compiled but could not be loaded." << std::endl;
+            iterations.push_back(iteration);
+            return;
+        }
+
+        iteration.loaded = true;
+        iteration.algorithmName = algo->getName();
+        iteration.sample = benchmarkManager.sampleExecution(ds, algo.get(), repetitions);
+        if (!iteration.sample.completed) {
+            std::cout << "[Watch] build " << iteration.number << " did not finish: " << iteration.sample.failure << std::endl;
+            iterations.push_back(iteration);
+            return;
+        }
+        std::cout << std::fixed << std::setprecision(3) << "[Watch] build " << iteration.number << " ["
+                  << iteration.build.describe() << (iteration.build.fromCache ? ", cached" : "") << "]: best "
+                  << iteration.sample.bestMs << " ms, mean " << iteration.sample.meanMs << " ms";
+        if (previousMs > 0.0) {
+            iteration.deltaPercent = (iteration.sample.bestMs - previousMs) / previousMs * 100.0;
+            std::cout << std::showpos << std::setprecision(1) << ", " << iteration.deltaPercent << std::noshowpos
+                      << "% vs build " << previousNumber;
+        }
+        std::cout << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+        std::cout << std::setprecision(6);
+
+        previousMs = iteration.sample.bestMs;
+        previousNumber = iteration.number;
+        iterations.push_back(iteration);
+    };
+
+    std::cout << "\n[Watch] " << fs::path(sourcePath).filename().string() << " on " << ds->getElements().size()
+              << " elements (" << (monitor.usesNotifications() ? "inotify" : "polling") << ", best of " << repetitions
+              << "); save the file to rebuild" << (stopOnEnter ? ", press Enter to stop" : "") << "." << std::endl;
+
+    rebuild();
+    while (!stopRequested && (maxBuilds <= 0 || static_cast<int>(iterations.size()) < maxBuilds)) {
+        const WakeReason reason = monitor.wait(stopOnEnter);
+        if (reason == WakeReason::STOP) {
+            break;
+        }
+        if (reason == WakeReason::CHANGED) {
+            rebuild();
+        }
+    }
+
+    release();
+    std::error_code ec;
+    fs::remove_all(scratch, ec);
+    std::cout << "[Watch] stopped after " << iterations.size() << " build(s)." << std::endl;
+    return iterations;
+}
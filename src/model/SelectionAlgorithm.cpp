@@ -0,0 +1,41 @@
+// src/model/SelectionAlgorithm.cpp
+#include "../../include/model/SelectionAlgorithm.hpp"
+#include <iostream>
+
+// Only the result is shown; the scratch copy is in no particular order.
+void SelectionAlgorithm::display(const std::vector<int>& elements) {
+    (void)elements;
+    if (isSmallest) {
+        std::cout << "The " << k << "-th smallest element is: " << result << std::endl;
+    } else {
+        std::cout << "The " << k << "-th largest element is: " << result << std::endl;
+    }
+}
+
+// Selects on a copy so the structure keeps its order.
+void SelectionAlgorithm::execute(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+    result = select(elements);
+}
+
+// Same as execute(), followed by the summary line.
+void SelectionAlgorithm::executeAndDisplay(DataStructure* ds) {
+    std::vector<int> elements = ds->getElements();
+    result = select(elements);
+    display(elements);
+}
+
+// Setter for the search direction.
+void SelectionAlgorithm::setIsSmallest(bool choice) {
+    isSmallest = choice;
+}
+
+// Setter for the rank.
+void SelectionAlgorithm::setK(int value) {
+    k = value;
+}
+
+// Getter for the last statistic.
+int SelectionAlgorithm::getResult() const {
+    return result;
+}
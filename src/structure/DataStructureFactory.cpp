@@ -56,7 +56,9 @@ LibraryHandle openLibrary(const std::string& path, std::string& error) {
     }
     return handle;
 #else
-    LibraryHandle handle = dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    // RTLD_LOCAL keeps the library's symbols out of the global scope, so two builds of one source loaded
+    // side by side each bind to their own code
+    LibraryHandle handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
     if (!handle) {
         const char* err = dlerror();
         error = err ? err : "Unknown error";
@@ -102,6 +104,8 @@ struct CustomDSLibraryInfo {
     LibraryHandle handle = nullptr;
     using CreateFn = DataStructure* (*)();
     CreateFn create = nullptr;
+    // Named variants, when the library exports a registry
+    const PluginRegistry* registry = nullptr;
     bool ownsFile = false;
 };
 
@@ -132,6 +136,61 @@ bool shouldOwnDSLibraryFile(const std::string& pathStr) {
     auto parent = path.parent_path().filename();
     return parent == "structure";
 }
+// Loads the library once and records its factory and registry; null when neither is usable.
+CustomDSLibraryInfo* loadCustomDSLibrary(const std::string& customLibraryPath) {
+    // Checks if already loaded
+    auto& libraries = customDSLibraries();
+    auto it = libraries.find(customLibraryPath);
+    if (it != libraries.end()) {
+        return &it->second;
+    }
+
+    // Load the shared object
+    CustomDSLibraryInfo info;
+    std::string loadError;
+    info.handle = openLibrary(customLibraryPath, loadError);
+    if (!info.handle) {
+        std::cerr << "Failed to load custom data structure library '"
+                  << customLibraryPath << "': " << loadError << std::endl;
+        return nullptr;
+    }
+
+    // Lookup the registry and the factory symbol; either one is enough
+    std::string symbolError;
+    auto registryFn = reinterpret_cast<PluginRegistryFn>(
+        loadSymbol(info.handle, RAYSTRUCT_REGISTRY_SYMBOL, symbolError));
+    if (registryFn) {
+        info.registry = registryFn();
+        if (!info.registry || info.registry->version != RAYSTRUCT_REGISTRY_VERSION) {
+            std::cerr << "Custom data structure library '" << customLibraryPath
+                      << "' exports a registry of an unsupported version." << std::endl;
+            closeLibrary(info.handle);
+            return nullptr;
+        }
+    }
+    info.create = reinterpret_cast<CustomDSLibraryInfo::CreateFn>(
+        loadSymbol(info.handle, "createDataStructure", symbolError));
+    if (!info.create && (!info.registry || info.registry->structureCount == 0)) {
+        std::cerr << "Failed to locate createDataStructure or " << RAYSTRUCT_REGISTRY_SYMBOL << " in '"
+                  << customLibraryPath << "': " << symbolError << std::endl;
+        closeLibrary(info.handle);
+        return nullptr;
+    }
+
+    // Determine ownership
+    info.ownsFile = shouldOwnDSLibraryFile(customLibraryPath);
+    return &libraries.emplace(customLibraryPath, info).first->second;
+}
+
+// Calls a factory function and reports a null result.
+DataStructure* instantiateDS(DataStructure* (*create)(), const std::string& customLibraryPath) {
+    DataStructure* instance = create ? create() : nullptr;
+    if (!instance) {
+        std::cerr << "Custom data structure factory returned nullptr from '"
+                  << customLibraryPath << "'." << std::endl;
+    }
+    return instance;
+}
 } // namespace
 
 // Factory method to create data structure instances based on the provided type
@@ -150,55 +209,51 @@ DataStructure* DataStructureFactory::createDataStructure(DataStructureEnum type,
             }
 
             {
-                // Checks if already loaded
-                auto& libraries = customDSLibraries();
-                auto it = libraries.find(customLibraryPath);
-                if (it == libraries.end()) {
-                    // Load the shared object
-                    CustomDSLibraryInfo info;
-                    std::string loadError;
-                    info.handle = openLibrary(customLibraryPath, loadError);
-                    if (!info.handle) {
-                        std::cerr << "Failed to load custom data structure library '"
-                                  << customLibraryPath << "': " << loadError << std::endl;
-                        return nullptr;
-                    }
-
-                    // Lookup factory symbol
-                    std::string symbolError;
-                    info.create = reinterpret_cast<CustomDSLibraryInfo::CreateFn>(
-                        loadSymbol(info.handle, "createDataStructure", symbolError));
-                    if (!info.create) {
-                        std::cerr << "Failed to locate createDataStructure in '"
-                                  << customLibraryPath << "': " << symbolError << std::endl;
-                        closeLibrary(info.handle);
-                        return nullptr;
-                    }
-
-                    // Determine ownership
-                    info.ownsFile = shouldOwnDSLibraryFile(customLibraryPath);
-                    it = libraries.emplace(customLibraryPath, info).first;
-                }
-
-                // Use factory function
-                if (!it->second.create) {
-                    std::cerr << "Custom library '" << customLibraryPath
-                              << "' did not provide a valid createDataStructure symbol." << std::endl;
+                CustomDSLibraryInfo* info = loadCustomDSLibrary(customLibraryPath);
+                if (!info) {
                     return nullptr;
                 }
 
-                DataStructure* instance = it->second.create();
-                if (!instance) {
-                    std::cerr << "Custom data structure factory returned nullptr from '"
-                              << customLibraryPath << "'." << std::endl;
-                }
-                return instance;
+                // Registry-only libraries default to their first structure
+                return instantiateDS(info->create ? info->create : info->registry->structures[0].create, customLibraryPath);
             }
         default:
             return nullptr;
     }
 }
 
+// Finds the named structure in the library's registry.
+DataStructure* DataStructureFactory::createCustomDataStructure(const std::string& customLibraryPath, const std::string& entryName) {
+    CustomDSLibraryInfo* info = loadCustomDSLibrary(customLibraryPath);
+    if (!info) {
+        return nullptr;
+    }
+
+    const PluginRegistry* registry = info->registry;
+    for (std::size_t i = 0; registry && i < registry->structureCount; ++i) {
+        if (registry->structures[i].name && entryName == registry->structures[i].name) {
+            return instantiateDS(registry->structures[i].create, customLibraryPath);
+        }
+    }
+    std::cerr << "Custom library '" << customLibraryPath << "' registers no data structure named '" << entryName << "'." << std::endl;
+    return nullptr;
+}
+
+// Copies the registry's structure table.
+bool DataStructureFactory::listCustomDataStructures(const std::string& customLibraryPath, std::vector<RegisteredEntry>& entries) {
+    entries.clear();
+    CustomDSLibraryInfo* info = loadCustomDSLibrary(customLibraryPath);
+    if (!info) {
+        return false;
+    }
+
+    const PluginRegistry* registry = info->registry;
+    for (std::size_t i = 0; registry && i < registry->structureCount; ++i) {
+        entries.push_back(RegisteredEntry::from(registry->structures[i]));
+    }
+    return true;
+}
+
 // Method to clear custom libraries and delete owned files
 void DataStructureFactory::cleanupCustomLibraries() {
     auto& libraries = customDSLibraries();
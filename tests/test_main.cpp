@@ -2,30 +2,66 @@
 #include "TestFramework.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cctype>
 #include <cmath>
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <random>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "../include/algorithm/AStar.hpp"
 #include "../include/algorithm/AlgorithmFactory.hpp"
 #include "../include/algorithm/HeapBuild.hpp"
 #include "../include/algorithm/HeapSelection.hpp"
+#include "../include/algorithm/QuickSelect.hpp"
+#include "../include/algorithm/SimdSelection.hpp"
+#include "../include/algorithm/StreamingSelection.hpp"
+#include "../include/algorithm/ParallelSelection.hpp"
+#include "../include/algorithm/ExternalMergeSort.hpp"
+#include "../include/algorithm/KWayMerge.hpp"
+#include "../include/algorithm/LoserTree.hpp"
+#include "../include/core/WorkStealingThreadPool.hpp"
 #include "../include/algorithm/InsertionSort.hpp"
+#include "../include/algorithm/LsdRadixSort.hpp"
 #include "../include/algorithm/MergeSort.hpp"
+#include "../include/algorithm/PdqSort.hpp"
 #include "../include/algorithm/Prims.hpp"
+#include "../include/algorithm/SimdKernels.hpp"
+#include "../include/algorithm/SimdSort.hpp"
+#include "../include/algorithm/SortingNetwork.hpp"
+#include "../include/algorithm/SortingNetworkSort.hpp"
+#include "../include/algorithm/StdSort.hpp"
 #include "../include/manager/BenchmarkManager.hpp"
+#include "../include/manager/BenchmarkScheduler.hpp"
+#include "../include/manager/PgoPipeline.hpp"
+#include "../include/manager/PluginCompiler.hpp"
+#include "../include/manager/PluginMatrix.hpp"
+#include "../include/manager/PluginSweep.hpp"
+#include "../include/manager/PluginWatcher.hpp"
 #include "../include/model/Algorithm.hpp"
 #include "../include/model/DataStructure.hpp"
 #include "../include/structure/DataStructureFactory.hpp"
 #include "../include/structure/GraphStructure.hpp"
 #include "../include/structure/HeapStructure.hpp"
 #include "../include/structure/ListStructure.hpp"
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#endif
 
 // Simple in-memory data structure used to feed deterministic values to algorithms
 class VectorDataStructure : public DataStructure {
@@ -92,6 +128,11 @@ public:
 // Dummy algorithm for exercising BenchmarkManager behavior
 class DummyAlgorithm : public Algorithm {
 public:
+    // Records that prepare() was triggered.
+    void prepare(DataStructure*) override {
+        ++prepareCount;
+    }
+
     // Records that execute() was triggered.
     void execute(DataStructure*) override {
         ++executeCount;
@@ -115,8 +156,149 @@ public:
         return executeCount;
     }
 
+    // Exposes how many times prepare() has been called.
+    int getPrepareCount() const {
+        return prepareCount;
+    }
+
 private:
     int executeCount = 0;
+    int prepareCount = 0;
+};
+
+// Algorithm that crashes, allocates or spins, for exercising subprocess isolation.
+class MisbehavingAlgorithm : public Algorithm {
+public:
+    enum class Mode { CRASH, ALLOCATE, SPIN, SLOW_PREPARE };
+
+    MisbehavingAlgorithm(Mode behaviour, std::size_t megabytes = 0) : mode(behaviour), allocateMb(megabytes) {}
+
+    // Only SLOW_PREPARE misbehaves here: the untimed set-up takes far longer than the run itself.
+    void prepare(DataStructure*) override {
+        if (mode == Mode::SLOW_PREPARE) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(400));
+        }
+    }
+
+    // Does the configured damage.
+    void execute(DataStructure*) override {
+        switch (mode) {
+            case Mode::CRASH:
+                std::raise(SIGSEGV);
+                break;
+            case Mode::ALLOCATE: {
+                // Touch every page and hold it long enough for the parent to notice
+                std::vector<char> block(allocateMb * 1024 * 1024, 1);
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                sink = block.back();
+                break;
+            }
+            case Mode::SPIN:
+                while (true) {
+                    sink = sink + 1;
+                }
+            case Mode::SLOW_PREPARE:
+                break;
+        }
+    }
+
+    // Same as execute().
+    void executeAndDisplay(DataStructure* ds) override {
+        execute(ds);
+    }
+
+    // Nothing to show.
+    void display(const std::vector<int>&) override {}
+
+    // Identifies the test double.
+    std::string getName() const override {
+        return "Misbehaving";
+    }
+
+private:
+    Mode mode;
+    std::size_t allocateMb;
+    volatile int sink = 0;
+};
+
+// Parallel algorithm whose execute() always throws, to check what the benchmark leaves behind.
+class ThrowingParallelAlgorithm : public Algorithm {
+public:
+    // Fails like an algorithm that runs out of memory half-way.
+    void execute(DataStructure*) override {
+        throw std::runtime_error("execute failed");
+    }
+
+    // Same as execute().
+    void executeAndDisplay(DataStructure* ds) override {
+        execute(ds);
+    }
+
+    // Nothing to show.
+    void display(const std::vector<int>&) override {}
+
+    // Identifies the test double.
+    std::string getName() const override {
+        return "Throwing";
+    }
+
+    // Takes part in scaling sweeps.
+    bool isParallel() const override {
+        return true;
+    }
+
+    // Stores the requested task count.
+    void setThreadCount(unsigned count) override {
+        threads = count;
+    }
+
+    // Returns the requested task count.
+    unsigned getThreadCount() const override {
+        return threads;
+    }
+
+    // Exposes the context the benchmark left in place.
+    ExecutionContext* getContext() const {
+        return context;
+    }
+
+private:
+    unsigned threads = 1;
+};
+
+// Parallel algorithm that records the size of the pool each execute() was given.
+class PoolProbeAlgorithm : public Algorithm {
+public:
+    // Notes the worker count of the pool in the current context.
+    void execute(DataStructure*) override {
+        poolThreads = context && context->pool ? context->pool->threadCount() : 0;
+    }
+
+    // Same as execute().
+    void executeAndDisplay(DataStructure* ds) override {
+        execute(ds);
+    }
+
+    // Nothing to show.
+    void display(const std::vector<int>&) override {}
+
+    // Identifies the test double.
+    std::string getName() const override {
+        return "Pool probe";
+    }
+
+    // Asks the benchmark for a pool.
+    bool isParallel() const override {
+        return true;
+    }
+
+    // Worker count seen by the last execute().
+    unsigned getPoolThreads() const {
+        return poolThreads;
+    }
+
+private:
+    unsigned poolThreads = 0;
 };
 
 // Helpers
@@ -208,6 +390,17 @@ bool isValidMinHeap(const std::vector<int>& values) {
     return true;
 }
 
+// Checks the heap property for any arity; before(a, b) is true when a may sit above b.
+template <typename Before>
+bool isValidHeap(const std::vector<int>& values, std::size_t arity, Before before) {
+    for (std::size_t child = 1; child < values.size(); ++child) {
+        if (before(values[child], values[(child - 1) / arity])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // Checks whether every parent is >= its children.
 bool isValidMaxHeap(const std::vector<int>& values) {
     for (std::size_t i = 0; i < values.size(); ++i) {
@@ -358,6 +551,69 @@ int main() {
                                 "InsertionSort final state should be sorted");
     });
 
+    suite.add("InsertionSort variants output sorted order", [](TestContext& ctx) {
+        for (auto variant : {InsertionSort::Variant::BINARY, InsertionSort::Variant::BRANCHLESS,
+                             InsertionSort::Variant::NETWORK}) {
+            VectorDataStructure ds({5, -3, 8, 5, 0, 2});
+            InsertionSort sorter;
+            sorter.setVariant(variant);
+            std::ostringstream captured;
+            {
+                ScopedStreamRedirect redirect(std::cout, captured);
+                sorter.executeAndDisplay(&ds);
+            }
+            auto finalState = extractLastNumberLine(captured.str());
+            ctx.expectSequenceEqual(finalState, std::vector<int>({-3, 0, 2, 5, 5, 8}),
+                                    sorter.getName() + " final state should be sorted");
+        }
+    });
+
+    suite.add("SortingNetworks sort every size up to kMaxSize", [](TestContext& ctx) {
+        std::mt19937 gen(11);
+        for (std::size_t n = 0; n <= SortingNetworks::kMaxSize; ++n) {
+            for (int trial = 0; trial < 50; ++trial) {
+                std::vector<int> values(n);
+                for (int& value : values) {
+                    value = static_cast<int>(gen() % 16) - 8;
+                }
+                std::vector<int> expected = values;
+                std::sort(expected.begin(), expected.end());
+                ctx.expect(SortingNetworks::sort(values.data(), n), "Network should exist for n <= kMaxSize");
+                ctx.expectSequenceEqual(values, expected, "Network for n=" + std::to_string(n));
+            }
+        }
+        std::vector<int> overflow(SortingNetworks::kMaxSize + 1);
+        ctx.expect(!SortingNetworks::sort(overflow.data(), overflow.size()), "Sizes above kMaxSize must be rejected");
+        ctx.expectEqual(SortingNetworks::comparatorCount(16), std::size_t(60), "n=16 should use the 60-comparator network");
+    });
+
+    suite.add("SortingNetworkSort sorts every block independently", [](TestContext& ctx) {
+        std::mt19937 gen(23);
+        for (std::size_t width : {2, 3, 7, 8, 16, 23, 32, 64}) {
+            // 8 full register batches, a few leftover blocks and a partial tail
+            std::vector<int> input(width * 21 + width / 2);
+            for (int& value : input) {
+                value = static_cast<int>(gen() % 2001) - 1000;
+            }
+
+            std::vector<int> expected = input;
+            for (std::size_t begin = 0; begin < expected.size(); begin += width) {
+                std::size_t end = std::min(expected.size(), begin + width);
+                std::sort(expected.begin() + begin, expected.begin() + end);
+            }
+
+            for (bool simd : {false, true}) {
+                SortingNetworkSort sorter;
+                sorter.setWidth(width);
+                sorter.setUseSimd(simd);
+                std::vector<int> values = input;
+                sorter.sortBatches(values);
+                ctx.expectSequenceEqual(values, expected,
+                                        sorter.getName() + " should sort each block of " + std::to_string(width));
+            }
+        }
+    });
+
     suite.add("MergeSort outputs sorted order", [](TestContext& ctx) {
         VectorDataStructure ds({9, 3, 7, 3, 1});
         MergeSort sorter;
@@ -371,6 +627,138 @@ int main() {
                                 "MergeSort final state should be sorted");
     });
 
+    suite.add("MergeSort multiway variant outputs sorted order", [](TestContext& ctx) {
+        std::mt19937 gen(67);
+        std::vector<int> values(2000);
+        for (int& value : values) {
+            value = static_cast<int>(gen() % 300) - 150;
+        }
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+
+        // Three ways force several levels; 64 ways finish in one merge above the base slices
+        for (std::size_t ways : {std::size_t(3), std::size_t(64)}) {
+            VectorDataStructure ds(values);
+            MergeSort sorter;
+            sorter.setVariant(MergeSort::Variant::MULTIWAY);
+            sorter.setWays(ways);
+            std::ostringstream captured;
+            {
+                ScopedStreamRedirect redirect(std::cout, captured);
+                sorter.executeAndDisplay(&ds);
+            }
+            ctx.expectSequenceEqual(extractLastNumberLine(captured.str()), sorted,
+                                    sorter.getName() + " final state should be sorted");
+        }
+    });
+
+    suite.add("SimdSort outputs sorted order", [](TestContext& ctx) {
+        VectorDataStructure ds({12, -4, 7, 7, 0, 25, -9, 3, 18, 1, 5});
+        SimdSort sorter;
+        std::ostringstream captured;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            sorter.executeAndDisplay(&ds);
+        }
+        auto finalState = extractLastNumberLine(captured.str());
+        ctx.expectSequenceEqual(finalState, std::vector<int>({-9, -4, 0, 1, 3, 5, 7, 7, 12, 18, 25}),
+                                "SimdSort final state should be sorted");
+    });
+
+    suite.add("SimdKernels sort matches std::sort on every instruction set", [](TestContext& ctx) {
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> wide(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+        std::uniform_int_distribution<int> narrow(-3, 3);
+        for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE4, SimdLevel::AVX2}) {
+            for (std::size_t n : {0u, 1u, 5u, 8u, 9u, 16u, 17u, 100u, 4099u}) {
+                std::vector<int> values(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    values[i] = (i % 2 == 0) ? wide(gen) : narrow(gen);
+                }
+                std::vector<int> expected = values;
+                std::sort(expected.begin(), expected.end());
+                SimdKernels::sort(values.data(), values.size(), level);
+                ctx.expectSequenceEqual(values, expected,
+                                        std::string("SimdKernels::sort at ") + SimdKernels::levelName(level));
+            }
+        }
+    });
+
+    suite.add("LsdRadixSort handles negatives for both digit widths", [](TestContext& ctx) {
+        std::mt19937 gen(7);
+        std::uniform_int_distribution<int> dist(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+        std::vector<int> values(200000);
+        for (int& value : values) {
+            value = dist(gen);
+        }
+        values[0] = std::numeric_limits<int>::min();
+        values[1] = std::numeric_limits<int>::max();
+        values[2] = -1;
+        values[3] = 0;
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        for (int bits : {8, 11}) {
+            for (unsigned threads : {1u, 4u}) {
+                LsdRadixSort sorter;
+                sorter.setDigitBits(bits);
+                sorter.setThreadCount(threads);
+                std::vector<int> sorted = values;
+                sorter.sort(sorted);
+                ctx.expectSequenceEqual(sorted, expected, sorter.getName() + " should match std::sort");
+            }
+        }
+    });
+
+    suite.add("LsdRadixSort skips passes on narrow keys", [](TestContext& ctx) {
+        VectorDataStructure ds({3, 1, 2, 3, 0, 1});
+        LsdRadixSort sorter;
+        std::ostringstream captured;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            sorter.executeAndDisplay(&ds);
+        }
+        auto finalState = extractLastNumberLine(captured.str());
+        ctx.expectSequenceEqual(finalState, std::vector<int>({0, 1, 1, 2, 3, 3}),
+                                "LsdRadixSort final state should be sorted");
+    });
+
+    suite.add("PdqSort handles adversarial patterns", [](TestContext& ctx) {
+        std::mt19937 gen(3);
+        std::vector<std::vector<int>> inputs;
+        std::vector<int> ascending(5000), descending(5000), fewUnique(5000), organPipe(5000), random(5000);
+        for (int i = 0; i < 5000; ++i) {
+            ascending[i] = i;
+            descending[i] = 5000 - i;
+            fewUnique[i] = static_cast<int>(gen() % 4) - 2;
+            organPipe[i] = i < 2500 ? i : 5000 - i;
+            random[i] = static_cast<int>(gen());
+        }
+        for (const auto& values : {ascending, descending, fewUnique, organPipe, random}) {
+            std::vector<int> sorted = values;
+            std::vector<int> expected = values;
+            std::sort(expected.begin(), expected.end());
+            PdqSort::sort(sorted);
+            ctx.expectSequenceEqual(sorted, expected, "PdqSort should match std::sort");
+        }
+    });
+
+    suite.add("StdSort variants output sorted order", [](TestContext& ctx) {
+        for (auto variant : {StdSort::Variant::SORT, StdSort::Variant::STABLE_SORT, StdSort::Variant::PARALLEL_SORT}) {
+            VectorDataStructure ds({4, -1, 9, 4, 0});
+            StdSort sorter;
+            sorter.setVariant(variant);
+            std::ostringstream captured;
+            {
+                ScopedStreamRedirect redirect(std::cout, captured);
+                sorter.executeAndDisplay(&ds);
+            }
+            auto finalState = extractLastNumberLine(captured.str());
+            ctx.expectSequenceEqual(finalState, std::vector<int>({-1, 0, 4, 4, 9}),
+                                    sorter.getName() + " final state should be sorted");
+        }
+    });
+
     suite.add("HeapBuild produces valid min heap", [](TestContext& ctx) {
         HeapBuildTestAdapter builder;
         std::vector<int> values = builder.build({9, 1, 6, 3, 4, 8}, true);
@@ -383,6 +771,71 @@ int main() {
         ctx.expect(isValidMaxHeap(values), "buildHeap(false) should enforce max-heap property");
     });
 
+    suite.add("HeapBuild engines build valid heaps", [](TestContext& ctx) {
+        std::mt19937 gen(31);
+        const std::pair<HeapBuild::Engine, std::size_t> engines[] = {
+            {HeapBuild::Engine::RECURSIVE, 2}, {HeapBuild::Engine::ITERATIVE, 2}, {HeapBuild::Engine::BOTTOM_UP, 2},
+            {HeapBuild::Engine::QUATERNARY, 4}, {HeapBuild::Engine::OCTONARY, 8}};
+
+        for (std::size_t n : {0, 1, 2, 5, 9, 64, 1000}) {
+            std::vector<int> values(n);
+            for (int& value : values) {
+                value = static_cast<int>(gen() % 100);
+            }
+
+            for (const auto& [engine, arity] : engines) {
+                HeapBuildTestAdapter builder;
+                builder.setEngine(engine);
+                ctx.expectEqual(builder.getArity(), arity, "Arity should match the engine");
+
+                auto minHeap = builder.build(values, true);
+                ctx.expect(isValidHeap(minHeap, arity, std::less<int>()),
+                           builder.getName() + " should build a min-heap of " + std::to_string(n));
+                ctx.expect(std::is_permutation(minHeap.begin(), minHeap.end(), values.begin()),
+                           builder.getName() + " should keep every element");
+
+                auto maxHeap = builder.build(values, false);
+                ctx.expect(isValidHeap(maxHeap, arity, std::greater<int>()),
+                           builder.getName() + " should build a max-heap of " + std::to_string(n));
+            }
+        }
+
+        // Timed d-ary runs rebuild the prepared input each time rather than the previous run's heap
+        std::vector<int> values(1000);
+        for (int& value : values) {
+            value = static_cast<int>(gen());
+        }
+        HeapBuildTestAdapter builder;
+        builder.setEngine(HeapBuild::Engine::OCTONARY);
+        builder.setHeapType(true);
+        builder.build(values, true);
+        const std::size_t expected = builder.getComparisons();
+        VectorDataStructure ds(values);
+        builder.prepare(&ds);
+        builder.execute(&ds);
+        ctx.expectEqual(builder.getComparisons(), expected, "A prepared build should match a plain one");
+        builder.execute(&ds);
+        ctx.expectEqual(builder.getComparisons(), expected, "A repeated run should start from the prepared input again");
+    });
+
+    suite.add("HeapBuild bottom-up engine needs fewer comparisons", [](TestContext& ctx) {
+        std::mt19937 gen(37);
+        std::vector<int> values(4096);
+        for (int& value : values) {
+            value = static_cast<int>(gen());
+        }
+
+        HeapBuildTestAdapter builder;
+        builder.build(values, true);
+        const std::size_t recursive = builder.getComparisons();
+        builder.setEngine(HeapBuild::Engine::BOTTOM_UP);
+        builder.build(values, true);
+        const std::size_t bottomUp = builder.getComparisons();
+
+        ctx.expect(recursive > 0, "Recursive build should count comparisons");
+        ctx.expect(bottomUp < recursive, "Bottom-up sift should compare less than the recursive heapify");
+    });
+
     suite.add("HeapSelection finds k-th smallest", [](TestContext& ctx) {
         VectorDataStructure ds({7, 4, 9, 2, 1});
         HeapSelection selection;
@@ -401,6 +854,370 @@ int main() {
         ctx.expectEqual(selection.getResult(), 9, "2nd largest in {12,9,7,5,3} is 9");
     });
 
+    suite.add("QuickSelect methods match sorted order", [](TestContext& ctx) {
+        std::mt19937 gen(41);
+        const QuickSelect::Method methods[] = {QuickSelect::Method::INTROSELECT, QuickSelect::Method::FLOYD_RIVEST,
+                                               QuickSelect::Method::NTH_ELEMENT};
+
+        for (std::size_t n : {1, 2, 17, 100, 5000}) {
+            // Narrow value range so runs of duplicates straddle the selected rank
+            std::vector<int> values(n);
+            for (int& value : values) {
+                value = static_cast<int>(gen() % 50) - 25;
+            }
+            std::vector<int> sorted = values;
+            std::sort(sorted.begin(), sorted.end());
+            VectorDataStructure ds(values);
+
+            for (QuickSelect::Method method : methods) {
+                QuickSelect selection;
+                selection.setMethod(method);
+                for (std::size_t k = 1; k <= n; k += std::max<std::size_t>(1, n / 7)) {
+                    selection.setK(static_cast<int>(k));
+                    selection.setIsSmallest(true);
+                    selection.execute(&ds);
+                    ctx.expectEqual(selection.getResult(), sorted[k - 1], selection.getName() + " k-th smallest");
+
+                    selection.setIsSmallest(false);
+                    selection.execute(&ds);
+                    ctx.expectEqual(selection.getResult(), sorted[n - k], selection.getName() + " k-th largest");
+                }
+            }
+        }
+    });
+
+    suite.add("QuickSelect introselect survives adversarial pivots", [](TestContext& ctx) {
+        // Organ-pipe input keeps median-of-three pivots near the extremes, forcing the fallback
+        const std::size_t n = 1 << 15;
+        std::vector<int> values(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            values[i] = static_cast<int>(i < n / 2 ? i : n - i);
+        }
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+
+        for (std::size_t index : {std::size_t(0), n / 3, n / 2, n - 1}) {
+            std::vector<int> scratch = values;
+            ctx.expectEqual(QuickSelect::introselect(scratch.data(), n, index), sorted[index],
+                            "introselect should find rank " + std::to_string(index));
+            scratch = values;
+            ctx.expectEqual(QuickSelect::floydRivest(scratch.data(), n, index), sorted[index],
+                            "Floyd-Rivest should find rank " + std::to_string(index));
+        }
+    });
+
+    suite.add("SimdSelection modes match sorted order at every level", [](TestContext& ctx) {
+        std::mt19937 gen(43);
+        for (std::size_t n : {1, 15, 40, 1000, 20000}) {
+            std::vector<int> values(n);
+            for (int& value : values) {
+                value = static_cast<int>(gen() % 3000) - 1500;
+            }
+            std::vector<int> sorted = values;
+            std::sort(sorted.begin(), sorted.end());
+            VectorDataStructure ds(values);
+
+            for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE4, SimdLevel::AVX2}) {
+                for (SimdSelection::Mode mode : {SimdSelection::Mode::QUICKSELECT, SimdSelection::Mode::TOP_K}) {
+                    SimdSelection selection;
+                    selection.setSimdLevel(level);
+                    selection.setMode(mode);
+                    for (std::size_t k : {std::size_t(1), (n + 1) / 2, n}) {
+                        selection.setK(static_cast<int>(k));
+                        selection.setIsSmallest(true);
+                        selection.execute(&ds);
+                        ctx.expectEqual(selection.getResult(), sorted[k - 1], selection.getName() + " k-th smallest");
+
+                        selection.setIsSmallest(false);
+                        selection.execute(&ds);
+                        ctx.expectEqual(selection.getResult(), sorted[n - k], selection.getName() + " k-th largest");
+                    }
+                }
+            }
+        }
+    });
+
+    suite.add("SimdSelection top-k keeps the k best elements", [](TestContext& ctx) {
+        std::mt19937 gen(47);
+        std::vector<int> values(50000);
+        for (int& value : values) {
+            value = static_cast<int>(gen());
+        }
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+        VectorDataStructure ds(values);
+
+        SimdSelection selection;
+        selection.setMode(SimdSelection::Mode::TOP_K);
+        selection.setIsSmallest(false);
+        selection.setK(100);
+        selection.execute(&ds);
+        ctx.expectSequenceEqual(selection.getTopK(), std::vector<int>(sorted.begin(), sorted.begin() + 100),
+                                "Top-100 should hold the largest keys, best first");
+    });
+
+    suite.add("StreamingSelection matches sorted order for every source", [](TestContext& ctx) {
+        std::mt19937 gen(53);
+        std::vector<int> values(25000);
+        for (int& value : values) {
+            value = static_cast<int>(gen() % 100000) - 50000;
+        }
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+
+        // Same values as a raw int32 file
+        const std::string path = (std::filesystem::temp_directory_path() / "raystruct_stream_test.bin").string();
+        {
+            std::ofstream file(path, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(int)));
+        }
+
+        VectorDataStructure ds(values);
+        for (bool fromFile : {false, true}) {
+            for (unsigned threads : {1u, 3u}) {
+                StreamingSelection selection;
+                if (fromFile) {
+                    selection.setFile(path);
+                }
+                selection.setChunkElements(1000);
+                selection.setThreadCount(threads);
+
+                for (std::size_t k : {std::size_t(1), std::size_t(77), std::size_t(5000)}) {
+                    selection.setK(static_cast<int>(k));
+                    selection.setIsSmallest(true);
+                    selection.execute(&ds);
+                    ctx.expectEqual(selection.getResult(), sorted[k - 1], selection.getName() + " k-th smallest");
+                    ctx.expectEqual(selection.getElementsStreamed(), values.size(), "Every element should be streamed");
+
+                    selection.setIsSmallest(false);
+                    selection.execute(&ds);
+                    ctx.expectEqual(selection.getResult(), sorted[values.size() - k], selection.getName() + " k-th largest");
+                }
+            }
+        }
+        std::filesystem::remove(path);
+    });
+
+    suite.add("StreamingSelection generator is independent of thread count", [](TestContext& ctx) {
+        VectorDataStructure ds({1, 2, 3});
+        StreamingSelection single;
+        single.setGenerator(200000, 7);
+        single.setChunkElements(4096);
+        single.setK(100);
+        single.execute(&ds);
+
+        StreamingSelection threaded;
+        threaded.setGenerator(200000, 7);
+        threaded.setChunkElements(4096);
+        threaded.setThreadCount(4);
+        threaded.setK(100);
+        threaded.execute(&ds);
+
+        ctx.expectEqual(single.getElementsStreamed(), std::size_t(200000), "Generator should produce every element");
+        ctx.expectEqual(threaded.getResult(), single.getResult(), "Merged per-thread buffers should give the same answer");
+        ctx.expect(single.getThroughput() > 0.0, "Throughput should be reported");
+        ctx.expectEqual(threaded.getThreadsUsed(), 4u, "Enough chunks should keep every thread busy");
+
+        // Two chunks can only keep two of eight threads busy, and the report should say so
+        StreamingSelection small;
+        small.setChunkElements(2);
+        small.setThreadCount(8);
+        small.setK(1);
+        std::ostringstream captured;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            small.executeAndDisplay(&ds);
+        }
+        ctx.expectEqual(small.getThreadsUsed(), 2u, "Threads should be capped at the chunk count");
+        ctx.expect(captured.str().find(" 2 thread(s)") != std::string::npos, "The throughput line should show the threads used");
+    });
+
+    suite.add("ParallelSelection matches sorted order for both strategies", [](TestContext& ctx) {
+        // Large enough that the sample-pivot path draws a real sample instead of falling back
+        std::mt19937 gen(59);
+        std::vector<int> values(400000);
+        for (int& value : values) {
+            value = static_cast<int>(gen() % 50000) - 25000;
+        }
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+
+        VectorDataStructure ds(values);
+        for (auto strategy : {ParallelSelection::Strategy::LOCAL_HEAPS, ParallelSelection::Strategy::SAMPLE_PIVOTS,
+                              ParallelSelection::Strategy::AUTO}) {
+            for (unsigned threads : {1u, 4u}) {
+                ParallelSelection selection;
+                selection.setStrategy(strategy);
+                selection.setThreadCount(threads);
+
+                for (std::size_t k : {std::size_t(1), std::size_t(100), std::size_t(123457), values.size()}) {
+                    selection.setK(static_cast<int>(k));
+                    selection.setIsSmallest(true);
+                    selection.execute(&ds);
+                    ctx.expectEqual(selection.getResult(), sorted[k - 1], selection.getName() + " k-th smallest");
+
+                    selection.setIsSmallest(false);
+                    selection.execute(&ds);
+                    ctx.expectEqual(selection.getResult(), sorted[values.size() - k], selection.getName() + " k-th largest");
+                }
+            }
+        }
+    });
+
+    suite.add("ExternalMergeSort writes sorted output from structures and files", [](TestContext& ctx) {
+        std::mt19937 gen(61);
+        std::vector<int> values(20000);
+        for (int& value : values) {
+            value = static_cast<int>(gen() % 4000) - 2000;
+        }
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+
+        const auto directory = std::filesystem::temp_directory_path();
+        const std::string inputPath = (directory / "raystruct_extsort_test_in.bin").string();
+        const std::string outputPath = (directory / "raystruct_extsort_test_out.bin").string();
+        {
+            std::ofstream file(inputPath, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(int)));
+        }
+
+        auto readOutput = [&outputPath]() {
+            std::ifstream file(outputPath, std::ios::binary | std::ios::ate);
+            std::vector<int> output(static_cast<std::size_t>(file.tellg()) / sizeof(int));
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(output.data()), static_cast<std::streamsize>(output.size() * sizeof(int)));
+            return output;
+        };
+
+        VectorDataStructure ds(values);
+        for (bool fromFile : {false, true}) {
+            ExternalMergeSort sorter;
+            if (fromFile) {
+                sorter.setInputFile(inputPath);
+            }
+            sorter.setOutputFile(outputPath);
+
+            // 4 KiB budget: 508-key runs (half the budget, the other half is the sort's scratch) and
+            // two-way merges, so several passes are needed
+            sorter.setMemoryBudget(4096);
+            sorter.execute(&ds);
+            ctx.expectSequenceEqual(readOutput(), sorted, sorter.getName() + " should sort across runs");
+            ctx.expectEqual(sorter.getRunCount(), std::size_t(40), "Every 508 keys should form a run");
+            ctx.expect(sorter.getMergePasses() > 1, "Two-way merges of 40 runs need several passes");
+            ctx.expect(sorter.getBytesWritten() > values.size() * sizeof(int), "Runs and merges should be counted as writes");
+
+            // A budget larger than the input sorts in one run and skips the merge
+            sorter.setMemoryBudget(std::size_t(1) << 20);
+            sorter.execute(&ds);
+            ctx.expectSequenceEqual(readOutput(), sorted, sorter.getName() + " should sort in one run");
+            ctx.expectEqual(sorter.getMergePasses(), std::size_t(0), "A single run needs no merge");
+            ctx.expectEqual(sorter.getBytesWritten(), std::uint64_t(values.size() * sizeof(int)), "Only the output should be written");
+        }
+
+#if defined(__linux__)
+        // A file size limit makes writes past 8 KiB fail (EFBIG) like a full disk would: the sort must throw
+        // and leave no run files behind. The 4 KiB budget fails while merging, the 1 MiB one in its only run.
+        const std::filesystem::path scratch = directory / "raystruct_extsort_full_test";
+        std::filesystem::create_directories(scratch);
+        rlimit previousLimit{};
+        getrlimit(RLIMIT_FSIZE, &previousLimit);
+        const auto previousHandler = std::signal(SIGXFSZ, SIG_IGN);
+        for (std::size_t budget : {std::size_t(4096), std::size_t(1) << 20}) {
+            ExternalMergeSort sorter;
+            sorter.setOutputFile(outputPath);
+            sorter.setTempDirectory(scratch.string());
+            sorter.setMemoryBudget(budget);
+            bool threw = false;
+            std::ostringstream errors;
+            const rlimit small{8192, previousLimit.rlim_max};
+            setrlimit(RLIMIT_FSIZE, &small);
+            try {
+                ScopedStreamRedirect redirect(std::cerr, errors);
+                sorter.execute(&ds);
+            } catch (const std::runtime_error&) {
+                threw = true;
+            }
+            setrlimit(RLIMIT_FSIZE, &previousLimit);
+            ctx.expect(threw, "A failed write should be reported, not truncate the output");
+            ctx.expect(std::filesystem::is_empty(scratch), "Run files should be removed after a failure");
+        }
+
+        // Benchmarked in this process with a scratch output, the failure is reported and the output removed
+        ExternalMergeSort scratchOutput;
+        scratchOutput.setTempDirectory(scratch.string());
+        scratchOutput.setMemoryBudget(4096);
+        BenchmarkManager benchmark;
+        benchmark.setOptions(BenchmarkOptions());
+        std::ostringstream report;
+        std::ostringstream errors;
+        const rlimit small{8192, previousLimit.rlim_max};
+        setrlimit(RLIMIT_FSIZE, &small);
+        {
+            ScopedStreamRedirect redirectOut(std::cout, report);
+            ScopedStreamRedirect redirectErr(std::cerr, errors);
+            benchmark.runBenchmark(&ds, &scratchOutput);
+        }
+        setrlimit(RLIMIT_FSIZE, &previousLimit);
+        ctx.expect(report.str().find("Benchmark aborted: Write error") != std::string::npos,
+                   "runBenchmark should report the I/O error instead of ending the session");
+        ctx.expect(std::filesystem::is_empty(scratch), "The scratch output should be removed after a failure");
+        std::signal(SIGXFSZ, previousHandler);
+        std::filesystem::remove_all(scratch);
+#endif
+
+        std::filesystem::remove(inputPath);
+        std::filesystem::remove(outputPath);
+    });
+
+    suite.add("LoserTree merges uneven runs including empty ones", [](TestContext& ctx) {
+        std::vector<std::vector<int>> runs = {{1, 4, 4, 9}, {}, {-3, 4, 10}, {2}, {}, {-5, -5, 0, 12, 13}};
+        std::vector<int> expected;
+        std::vector<LoserTree::Run> views;
+        for (const auto& run : runs) {
+            expected.insert(expected.end(), run.begin(), run.end());
+            views.push_back({run.data(), run.data() + run.size()});
+        }
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<int> output(expected.size());
+        LoserTree::merge(views, output.data());
+        ctx.expectSequenceEqual(output, expected, "Merged runs should be in sorted order");
+
+        // Equal keys come out in leaf order
+        LoserTree tree(3);
+        tree.setLeaf(0, 7);
+        tree.setLeaf(1, 7);
+        tree.retireLeaf(2);
+        tree.build();
+        ctx.expectEqual(tree.winner(), std::size_t(0), "Ties should go to the lower leaf");
+        tree.retireWinner();
+        ctx.expectEqual(tree.winner(), std::size_t(1), "The other tied leaf should win next");
+        tree.retireWinner();
+        ctx.expect(tree.empty(), "Tree should be empty once every leaf retires");
+    });
+
+    suite.add("KWayMerge engines agree with sorted order", [](TestContext& ctx) {
+        std::mt19937 gen(71);
+        std::vector<int> values(10007);
+        for (int& value : values) {
+            value = static_cast<int>(gen());
+        }
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+
+        VectorDataStructure ds(values);
+        for (std::size_t ways : {std::size_t(1), std::size_t(5), std::size_t(16), std::size_t(100)}) {
+            for (auto engine : {KWayMerge::Engine::LOSER_TREE, KWayMerge::Engine::HEAP, KWayMerge::Engine::PAIRWISE}) {
+                KWayMerge merge;
+                merge.setWays(ways);
+                merge.setEngine(engine);
+                merge.prepare(&ds);
+                merge.execute(&ds);
+                ctx.expectSequenceEqual(merge.getOutput(), sorted, merge.getName() + " should produce sorted output");
+            }
+        }
+    });
+
     suite.add("AStar finds optimal path", [](TestContext& ctx) {
         GraphStructure graph;
         graph.addEdge(1, 2, 1.0);
@@ -471,12 +1288,880 @@ int main() {
                         "Disconnected graph should still collect spanning edges per component");
     });
 
+#if defined(__linux__)
+    suite.add("WorkStealingThreadPool does not starve a worker sharing a SCHED_FIFO waiter's CPU", [](TestContext& ctx) {
+        // A single-CPU list leaves the worker on the waiting thread's CPU. A waiter that only yields under
+        // SCHED_FIFO would keep it off until real-time throttling steps in (~950 ms per second by default).
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        sched_getaffinity(0, sizeof(allowed), &allowed);
+        unsigned cpu = 0;
+        while (!CPU_ISSET(cpu, &allowed)) {
+            ++cpu;
+        }
+
+        WorkStealingThreadPool pool(2);
+        pool.pinTo({cpu});
+        bool realtime = false;
+        double elapsedMs = 0.0;
+        std::atomic<int> ran{0};
+        std::thread waiter([&]() {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            sched_param param{};
+            param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+            realtime = sched_setaffinity(0, sizeof(set), &set) == 0 && pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (int round = 0; round < 5; ++round) {
+                // Task 0 sleeps so the worker picks up task 1; the waiter then preempts it mid-task and has
+                // nothing left to steal
+                pool.runTasks(2, [&](unsigned t) {
+                    if (t == 0) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                        return;
+                    }
+                    const auto busyUntil = std::chrono::steady_clock::now() + std::chrono::milliseconds(5);
+                    while (std::chrono::steady_clock::now() < busyUntil) {
+                    }
+                    ++ran;
+                });
+            }
+            elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        });
+        waiter.join();
+
+        ctx.expectEqual(ran.load(), 5, "Every pool task should run");
+        if (realtime) {
+            ctx.expect(elapsedMs < 300.0, "The waiter should block instead of starving the worker (" + std::to_string(elapsedMs) + " ms)");
+        }
+    });
+#endif
+
+    suite.add("WorkStealingThreadPool runs parallelFor and nested fork/join", [](TestContext& ctx) {
+        for (unsigned threads : {1u, 4u}) {
+            WorkStealingThreadPool pool(threads);
+            ctx.expectEqual(pool.threadCount(), threads, "Pool should report its thread count");
+
+            std::vector<int> values(100000);
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                values[i] = static_cast<int>(i % 1000);
+            }
+            long long expected = 0;
+            for (int value : values) {
+                expected += value;
+            }
+
+            std::atomic<long long> chunked{0};
+            pool.parallelFor(0, values.size(), 4096, [&](std::size_t begin, std::size_t end) {
+                long long partial = 0;
+                for (std::size_t i = begin; i < end; ++i) {
+                    partial += values[i];
+                }
+                chunked += partial;
+            });
+            ctx.expectEqual(chunked.load(), expected, "parallelFor should visit every index once");
+
+            // Recursive halving forks from inside tasks, which only finishes if waiters help run work
+            std::function<long long(std::size_t, std::size_t)> sum = [&](std::size_t begin, std::size_t end) {
+                if (end - begin <= 1000) {
+                    long long partial = 0;
+                    for (std::size_t i = begin; i < end; ++i) {
+                        partial += values[i];
+                    }
+                    return partial;
+                }
+                const std::size_t mid = begin + (end - begin) / 2;
+                long long left = 0, right = 0;
+                pool.forkJoin([&]() { left = sum(begin, mid); }, [&]() { right = sum(mid, end); });
+                return left + right;
+            };
+            ctx.expectEqual(sum(0, values.size()), expected, "Nested forkJoin should add up every value");
+
+            bool rethrown = false;
+            try {
+                pool.runTasks(8, [](unsigned t) {
+                    if (t == 5) {
+                        throw std::runtime_error("task failed");
+                    }
+                });
+            } catch (const std::runtime_error&) {
+                rethrown = true;
+            }
+            ctx.expect(rethrown, "A task exception should be rethrown by the waiting thread");
+        }
+
+        WorkStealingThreadPool pool(1);
+        pool.configure(3, false);
+        ctx.expectEqual(pool.threadCount(), 3u, "configure should resize the pool");
+        std::atomic<int> ran{0};
+        pool.runTasks(16, [&](unsigned) { ++ran; });
+        ctx.expectEqual(ran.load(), 16, "Every task should run after reconfiguring");
+    });
+
+    suite.add("BenchmarkManager scaling sweep covers strong and weak scaling", [](TestContext& ctx) {
+        std::mt19937 gen(73);
+        std::vector<int> values(50000);
+        for (int& value : values) {
+            value = static_cast<int>(gen());
+        }
+        VectorDataStructure ds(values);
+
+        BenchmarkManager benchmark;
+        LsdRadixSort sorter;
+        sorter.setThreadCount(2);
+        ScalingReport report;
+        {
+            std::ostringstream captured;
+            ScopedStreamRedirect redirect(std::cout, captured);
+            report = benchmark.runScalingSweep(&ds, &sorter, 3, 1);
+        }
+
+        ctx.expectEqual(report.strong.size(), std::size_t(3), "Sweep should run 1, 2 and 3 threads");
+        ctx.expectEqual(report.weak.size(), std::size_t(3), "Weak scaling should cover the same thread counts");
+        ctx.expectEqual(report.strong[2].threads, 3u, "The last point should use the maximum thread count");
+        ctx.expectEqual(report.weak[2].elements, values.size() * 3, "Weak scaling should grow the input with threads");
+        ctx.expect(report.strong[0].speedup > 0.99 && report.strong[0].speedup < 1.01, "One thread is the baseline");
+        ctx.expectEqual(sorter.getThreadCount(), 2u, "The sweep should restore the algorithm's thread count");
+
+        DummyAlgorithm serial;
+        ScalingReport skipped;
+        {
+            std::ostringstream captured;
+            ScopedStreamRedirect redirect(std::cout, captured);
+            skipped = benchmark.runScalingSweep(&ds, &serial, 4);
+        }
+        ctx.expect(skipped.strong.empty() && serial.getExecuteCount() == 0, "Serial algorithms should not be swept");
+
+        // A throwing run must not leave the algorithm on the sweep's pool, which dies with the sweep
+        ThrowingParallelAlgorithm failing;
+        failing.setThreadCount(2);
+        bool threw = false;
+        try {
+            std::ostringstream captured;
+            ScopedStreamRedirect redirect(std::cout, captured);
+            benchmark.runScalingSweep(&ds, &failing, 4);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        ctx.expect(threw, "The algorithm's exception should reach the caller");
+        ctx.expect(failing.getContext() && failing.getContext()->pool == &WorkStealingThreadPool::shared(),
+                   "The manager's context should be restored after the exception");
+        ctx.expectEqual(failing.getThreadCount(), 2u, "The thread count should be restored after the exception");
+    });
+
+    suite.add("PluginCompiler builds custom algorithms with the selected profile", [](TestContext& ctx) {
+        BuildProfile profile = BuildProfile::O2;
+        ctx.expect(PluginCompiler::parseProfile("O3", profile) && profile == BuildProfile::O3_NATIVE, "O3 should map to O3 + native");
+        ctx.expect(!PluginCompiler::parseProfile("fast", profile), "Unknown profiles should be rejected");
+
+        PluginCompiler compiler;
+        ctx.expectEqual(compiler.profileFlags(), std::string("-O2"), "Plugins should be optimised by default");
+        ctx.expect(!compiler.setCustomFlags("-O2; rm -rf /"), "Shell metacharacters should be refused");
+        ctx.expect(compiler.setCustomFlags("-O1 -fno-inline"), "Plain flags should be accepted");
+        compiler.setProfile(BuildProfile::CUSTOM);
+        ctx.expectEqual(compiler.profileFlags(), std::string("-O1 -fno-inline"), "Custom profile should use the given flags");
+
+        const std::filesystem::path root = std::filesystem::path(__FILE__).parent_path().parent_path();
+        const std::filesystem::path outDir = std::filesystem::temp_directory_path() / "raystruct_plugin_test";
+        compiler.setProfile(BuildProfile::O3_NATIVE);
+        PluginBuild build = compiler.compile((root / "custom" / "RadixSort.cpp").string(), outDir.string());
+        ctx.expect(build.succeeded, "The example plugin should compile: " + build.compilerOutput);
+        ctx.expect(build.command.find("-O3 -march=native") != std::string::npos, "The command should carry the profile flags");
+        ctx.expectEqual(std::filesystem::path(build.libraryPath).filename().string(), std::string("RadixSort_o3native_custom.so"),
+                        "The profile should be part of the library name");
+        ctx.expectEqual(build.describe(), std::string("g++ O3 + native (-O3 -march=native)"), "The build should describe itself");
+
+        if (build.succeeded) {
+            std::unique_ptr<Algorithm> plugin(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, build.libraryPath));
+            ctx.expect(plugin != nullptr, "The compiled plugin should load");
+            if (plugin) {
+                VectorDataStructure ds({3, 1, 2});
+                plugin->execute(&ds);
+            }
+        }
+
+        compiler.setProfile(BuildProfile::CUSTOM);
+        PluginBuild first = compiler.compile((root / "custom" / "RadixSort.cpp").string(), outDir.string());
+        compiler.setCustomFlags("-O1");
+        PluginBuild second = compiler.compile((root / "custom" / "RadixSort.cpp").string(), outDir.string());
+        ctx.expect(first.succeeded && second.succeeded, "Both custom builds should compile");
+        ctx.expect(first.libraryPath != second.libraryPath, "Different custom flags should build different libraries");
+        ctx.expect(std::filesystem::exists(first.libraryPath), "The second build should leave the first one's library alone");
+
+        // A build in an algorithm/ directory is owned by the factory, like the session's fallback build
+        PluginBuild owned = compiler.compile((root / "custom" / "RadixSort.cpp").string(), (outDir / "algorithm").string());
+        ctx.expect(owned.succeeded, "The owned build should compile: " + owned.compilerOutput);
+        if (owned.succeeded) {
+            delete AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, owned.libraryPath);
+            ctx.expect(AlgorithmFactory::unloadCustomLibrary(owned.libraryPath, true) && std::filesystem::exists(owned.libraryPath),
+                       "Unloading with keepFile should leave the library on disk");
+            std::unique_ptr<Algorithm> reloaded(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, owned.libraryPath));
+            ctx.expect(reloaded != nullptr, "A kept library should load again");
+            reloaded.reset();
+            AlgorithmFactory::unloadCustomLibrary(owned.libraryPath);
+            ctx.expect(!std::filesystem::exists(owned.libraryPath), "A plain unload should still delete an owned library");
+        }
+        AlgorithmFactory::cleanupCustomLibraries();
+        std::error_code ec;
+        std::filesystem::remove_all(outDir, ec);
+    });
+
+    suite.add("PluginCache reuses builds until the source or flags change", [](TestContext& ctx) {
+        ctx.expectEqual(PluginCache::fnv1a("a"), std::uint64_t(0xaf63dc4c8601ec8cull), "FNV-1a should match the reference value");
+
+        const std::filesystem::path root = std::filesystem::absolute(__FILE__).parent_path().parent_path();
+        const std::filesystem::path work = std::filesystem::temp_directory_path() / "raystruct_cache_test";
+        std::error_code ec;
+        std::filesystem::remove_all(work, ec);
+        std::filesystem::create_directories(work / "src", ec);
+        const std::filesystem::path source = work / "src" / "CachedSort.cpp";
+        std::filesystem::copy_file(root / "custom" / "RadixSort.cpp", source, ec);
+        // The copy sits outside the tree, so point its include at the real header
+        {
+            std::ifstream in(source);
+            std::stringstream text;
+            text << in.rdbuf();
+            std::string contents = text.str();
+            const std::string from = "../include/model/Algorithm.hpp";
+            contents.replace(contents.find(from), from.size(), (root / "include" / "model" / "Algorithm.hpp").string());
+            std::ofstream(source) << contents;
+        }
+
+        PluginCache cache((work / "cache").string());
+        ctx.expect(cache.isUsable(), "The cache directory should be created");
+
+        PluginCompiler compiler;
+        PluginBuild first = compiler.compile(source.string(), cache);
+        ctx.expect(first.succeeded && !first.fromCache, "The first build should run the compiler: " + first.compilerOutput);
+        PluginBuild second = compiler.compile(source.string(), cache);
+        ctx.expect(second.succeeded && second.fromCache, "An unchanged build should come from the cache");
+        ctx.expectEqual(second.libraryPath, first.libraryPath, "A hit should return the same library");
+        ctx.expectEqual(second.command, first.command, "A hit should report the original command");
+
+        compiler.setProfile(BuildProfile::DEBUG);
+        ctx.expect(compiler.cacheKey(source.string()) != first.cacheKey, "Other flags should change the key");
+        compiler.setProfile(BuildProfile::O2);
+
+        std::ofstream(source, std::ios::app) << "\n// edited\n";
+        ctx.expect(compiler.cacheKey(source.string()) != first.cacheKey, "Editing the source should change the key");
+        ctx.expect(PluginCache::hashSource((root / "src" / "main.cpp").string(), {(root / "include").string()}) != 0,
+                   "Sources with project includes should hash");
+
+        // A scratch directory left by an interrupted build goes too, with its contents
+        std::filesystem::create_directories(std::filesystem::path(cache.getDirectory()) / "build_interrupted");
+        std::ofstream(std::filesystem::path(cache.getDirectory()) / "build_interrupted" / "partial.o") << "x";
+        ctx.expectEqual(cache.clear(), std::size_t(4), "Clearing should remove the library, its log and the scratch directory");
+        ctx.expect(std::filesystem::is_empty(cache.getDirectory()), "Nothing should be left in the cache directory");
+        std::filesystem::remove_all(work, ec);
+    });
+
+    suite.add("PgoPipeline trains, rebuilds and compares a custom algorithm", [](TestContext& ctx) {
+        const std::filesystem::path root = std::filesystem::absolute(__FILE__).parent_path().parent_path();
+        const std::filesystem::path work = std::filesystem::temp_directory_path() / "raystruct_pgo_test";
+
+        std::mt19937 gen(5);
+        std::vector<int> values(20000);
+        for (int& value : values) {
+            value = static_cast<int>(gen() % 100000);
+        }
+        VectorDataStructure ds(values);
+        std::shuffle(values.begin(), values.end(), gen);
+        VectorDataStructure training(values);
+
+        PluginCompiler compiler;
+        compiler.setProfileGuidance(PluginCompiler::ProfileGuidance::USE, work.string());
+        ctx.expect(compiler.profileFlags().find("-Wno-missing-profile") == std::string::npos,
+                   "A missing profile should not be silenced");
+        compiler.setProfileGuidance(PluginCompiler::ProfileGuidance::NONE, "");
+        PgoPipeline pipeline(compiler, work.string());
+        pipeline.setRepetitions(1);
+        BenchmarkManager benchmark;
+        PgoComparison result;
+        {
+            std::ostringstream captured;
+            ScopedStreamRedirect redirect(std::cout, captured);
+            result = pipeline.run((root / "custom" / "RadixSort.cpp").string(), &training, &ds, benchmark);
+        }
+
+        ctx.expect(result.succeeded, "The pipeline should complete: " + result.message);
+        ctx.expect(result.optimised.compilerOutput.find("missing-profile") == std::string::npos,
+                   "The PGO build should find the training profile");
+        ctx.expect(result.profileFiles > 0, "The training run should write profile data");
+        ctx.expect(result.instrumented.flags.find("-fprofile-generate") != std::string::npos, "Training build should be instrumented");
+        ctx.expect(result.optimised.flags.find("-fprofile-use") != std::string::npos, "Second build should use the profile");
+        ctx.expectEqual(result.optimised.libraryPath, result.instrumented.libraryPath, "Both PGO builds should share one output path");
+        ctx.expect(result.baselineMs > 0.0 && result.optimisedMs > 0.0, "Both builds should be timed");
+        ctx.expect(!AlgorithmFactory::isCustomLibraryLoaded(result.baseline.libraryPath) &&
+                   !AlgorithmFactory::isCustomLibraryLoaded(result.optimised.libraryPath), "Both builds should be unloaded");
+        ctx.expect(!std::filesystem::exists(work), "The work directory should be removed");
+    });
+
+    suite.add("PluginMatrix builds and times every compiler and flag variant", [](TestContext& ctx) {
+        const std::filesystem::path root = std::filesystem::absolute(__FILE__).parent_path().parent_path();
+        const std::filesystem::path cacheDir = std::filesystem::temp_directory_path() / "raystruct_matrix_test";
+
+        PluginMatrix matrix;
+        matrix.setCacheDirectory(cacheDir.string());
+        matrix.setRepetitions(2);
+        ctx.expect(matrix.addVariant(PluginVariant{"g++", BuildProfile::O2, ""}), "g++ O2 should be accepted");
+        ctx.expect(matrix.addVariant(PluginVariant{"g++", BuildProfile::CUSTOM, "-O1"}), "A custom flag set should be accepted");
+        ctx.expect(matrix.addVariant(PluginVariant{"raystruct-no-such-cxx", BuildProfile::O2, ""}), "Unknown compilers are only found at build time");
+        ctx.expect(!matrix.addVariant(PluginVariant{"g++ -v", BuildProfile::O2, ""}), "Compiler names with spaces should be refused");
+        ctx.expectEqual(matrix.getVariants().size(), std::size_t(3), "Refused variants should not be added");
+        ctx.expectEqual(matrix.getVariants()[1].label(), std::string("g++ -O1"), "Custom variants should be labelled by their flags");
+
+        VectorDataStructure ds({9, 3, 7, 1, 8, 2, 6, 4, 5});
+        BenchmarkManager benchmark;
+        std::vector<PluginVariantResult> results;
+        std::ostringstream captured;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            results = matrix.run((root / "custom" / "RadixSort.cpp").string(), &ds, benchmark);
+        }
+
+        ctx.expectEqual(results.size(), std::size_t(3), "Every variant should get a result");
+        ctx.expect(results[0].loaded && results[1].loaded, "The g++ variants should build and load");
+        ctx.expect(results[0].build.libraryPath != results[1].build.libraryPath, "Variants should not share a library");
+        ctx.expectEqual(results[0].sample.runs, 2, "Each variant should run the requested repetitions");
+        ctx.expect(!results[2].build.succeeded && !results[2].loaded, "A missing compiler should fail only its own variant");
+        ctx.expect(captured.str().find("build failed") != std::string::npos, "The table should mark the failed build");
+
+        AlgorithmFactory::cleanupCustomLibraries();
+        std::error_code ec;
+        std::filesystem::remove_all(cacheDir, ec);
+    });
+
+    suite.add("Builds of one plugin source each run their own code", [](TestContext& ctx) {
+        const std::filesystem::path root = std::filesystem::absolute(__FILE__).parent_path().parent_path();
+        const std::filesystem::path work = std::filesystem::temp_directory_path() / "raystruct_variant_test";
+        std::error_code ec;
+        std::filesystem::remove_all(work, ec);
+        std::filesystem::create_directories(work, ec);
+        const std::filesystem::path source = work / "Tagged.cpp";
+        {
+            // getName is inline, so every build exports the same weak symbol with a different body
+            std::ofstream out(source);
+            out << "#include \"" << (root / "include" / "model" / "Algorithm.hpp").string() << "\"\n"
+                << "#include <string>\n"
+                << "class Tagged : public Algorithm {\n"
+                << "public:\n"
+                << "    void execute(DataStructure*) override {}\n"
+                << "    void executeAndDisplay(DataStructure*) override {}\n"
+                << "    void display(const std::vector<int>&) override {}\n"
+                << "    std::string getName() const override { return \"Tagged \" + std::to_string(TAG); }\n"
+                << "};\n"
+                << "extern \"C\" Algorithm* createAlgorithm() { return new Tagged(); }\n";
+        }
+
+        PluginMatrix matrix;
+        matrix.setCacheDirectory((work / "cache").string());
+        matrix.setRepetitions(1);
+        matrix.addVariant(PluginVariant{"g++", BuildProfile::CUSTOM, "-O1 -DTAG=1"});
+        matrix.addVariant(PluginVariant{"g++", BuildProfile::CUSTOM, "-O1 -DTAG=2"});
+        VectorDataStructure ds({2, 1});
+        BenchmarkManager benchmark;
+        std::vector<PluginVariantResult> results;
+        std::ostringstream captured;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            results = matrix.run(source.string(), &ds, benchmark);
+        }
+        ctx.expect(results.size() == 2 && results[0].loaded && results[1].loaded, "Both variants should build and load");
+        if (results.size() == 2) {
+            ctx.expectEqual(results[0].algorithmName, std::string("Tagged 1"), "The first variant should run its own getName");
+            ctx.expectEqual(results[1].algorithmName, std::string("Tagged 2"), "The second variant should run its own getName");
+            ctx.expect(!AlgorithmFactory::isCustomLibraryLoaded(results[0].build.libraryPath), "The matrix should unload each variant");
+
+            // Loaded side by side, neither library may resolve the other's inline getName
+            std::unique_ptr<Algorithm> first(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, results[0].build.libraryPath));
+            std::unique_ptr<Algorithm> second(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, results[1].build.libraryPath));
+            ctx.expect(first && second, "Both builds should load at once");
+            if (first && second) {
+                ctx.expectEqual(first->getName(), std::string("Tagged 1"), "The first build should keep its own code");
+                ctx.expectEqual(second->getName(), std::string("Tagged 2"), "The second build should not bind to the first");
+            }
+        }
+
+        // Scheduled, both variants are loaded for the whole batch and timed in pinned children
+        AlgorithmFactory::cleanupCustomLibraries();
+        const unsigned cpu = CoreTopology::detect().cores.front().front();
+        CoreTopology shared;
+        shared.cores = {{cpu}, {cpu}};
+        shared.l3Domains = {{0, 1}};
+        BenchmarkScheduler scheduler(shared);
+        matrix.setScheduler(&scheduler);
+        captured.str("");
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            results = matrix.run(source.string(), &ds, benchmark);
+        }
+        ctx.expect(results.size() == 2 && results[0].sample.completed && results[1].sample.completed,
+                   "Scheduled variants should all be timed");
+        if (results.size() == 2) {
+            ctx.expectEqual(results[1].algorithmName, std::string("Tagged 2"), "Scheduled variants should keep their own code");
+            ctx.expect(!AlgorithmFactory::isCustomLibraryLoaded(results[0].build.libraryPath) &&
+                           !AlgorithmFactory::isCustomLibraryLoaded(results[1].build.libraryPath),
+                       "The matrix should unload its variants after the batch");
+        }
+        ctx.expect(captured.str().find("[Scheduler] 2 scenario(s): 2 concurrent") != std::string::npos,
+                   "The variants should go through the scheduler");
+        AlgorithmFactory::cleanupCustomLibraries();
+        std::filesystem::remove_all(work, ec);
+    });
+
+    suite.add("AlgorithmFactory drives raw-buffer ABI plugins through the adapter", [](TestContext& ctx) {
+        RaystructPluginInfo info{RAYSTRUCT_PLUGIN_ABI_VERSION, sizeof(RaystructPluginInfo), "Probe",
+                                 RAYSTRUCT_CAP_SORT | RAYSTRUCT_CAP_INT32, nullptr, nullptr};
+        std::string error;
+        ctx.expect(!RawBufferAlgorithm::isUsable(&info, error), "A descriptor without run should be refused");
+        info.run = [](const RaystructCall*) { return 0; };
+        info.abi_version = RAYSTRUCT_PLUGIN_ABI_VERSION + 1;
+        ctx.expect(!RawBufferAlgorithm::isUsable(&info, error), "A newer ABI version should be refused");
+        info.abi_version = RAYSTRUCT_PLUGIN_ABI_VERSION;
+        info.capabilities = RAYSTRUCT_CAP_SORT;
+        ctx.expect(!RawBufferAlgorithm::isUsable(&info, error), "A plugin without an element width should be refused");
+
+        const std::filesystem::path root = std::filesystem::absolute(__FILE__).parent_path().parent_path();
+        const std::filesystem::path outDir = std::filesystem::temp_directory_path() / "raystruct_raw_abi_test";
+        PluginCompiler compiler;
+        PluginBuild build = compiler.compile((root / "custom" / "RawRadixSort.cpp").string(), outDir.string());
+        ctx.expect(build.succeeded, "The raw-buffer example should compile: " + build.compilerOutput);
+        if (build.succeeded) {
+            std::unique_ptr<Algorithm> plugin(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, build.libraryPath));
+            auto* raw = dynamic_cast<RawBufferAlgorithm*>(plugin.get());
+            ctx.expect(raw != nullptr, "A library exporting the ABI entry point should be wrapped in the adapter");
+            if (raw) {
+                VectorDataStructure ds({5, -3, 900000, 0, -70000, 5, 12});
+                raw->setRepetitions(3);
+                raw->prepare(&ds);
+                raw->execute(&ds);
+                ctx.expectEqual(raw->getLastStatus(), 0, "The plugin should report success");
+                ctx.expect(raw->getOutput() == std::vector<int>({-70000, -3, 0, 5, 5, 12, 900000}), "Signed keys should come back sorted");
+                ctx.expectEqual(raw->getRepetitions(), std::size_t(3), "Repetitions should be reported to the benchmark");
+                ctx.expectEqual(raw->getName(), std::string("Raw Radix Sort (raw ABI v1) x3"), "The name should come from the descriptor");
+            }
+        }
+
+        // A failing call must fail the sample rather than show up as a fast run
+        info.capabilities = RAYSTRUCT_CAP_SORT | RAYSTRUCT_CAP_INT32;
+        info.run = [](const RaystructCall*) { return 7; };
+        RawBufferAlgorithm failing(&info);
+        VectorDataStructure failingInput({3, 1, 2});
+        BenchmarkManager inProcess;
+        BenchmarkOptions plain;
+        inProcess.setOptions(plain);
+        const ExecutionSample failedSample = inProcess.sampleExecution(&failingInput, &failing, 2);
+        ctx.expect(!failedSample.completed && failedSample.failure.find("error code 7") != std::string::npos,
+                   "A non-zero status should fail the sample: " + failedSample.failure);
+        ctx.expectEqual(failing.getLastStatus(), 7, "The status should still be kept");
+#if defined(__linux__)
+        BenchmarkManager forked;
+        BenchmarkOptions childOptions;
+        childOptions.subprocess = true;
+        forked.setOptions(childOptions);
+        const ExecutionSample childSample = forked.sampleExecution(&failingInput, &failing, 2);
+        ctx.expect(!childSample.completed && childSample.failure.find("error code 7") != std::string::npos,
+                   "A child run should report the status too: " + childSample.failure);
+#endif
+
+#if defined(__linux__)
+        // An odd key count ends the key buffer halfway through a word; the histograms after it must still be aligned
+        compiler.setCustomFlags("-O1 -fsanitize=alignment -fno-sanitize-recover=all");
+        compiler.setProfile(BuildProfile::CUSTOM);
+        PluginBuild checked = compiler.compile((root / "custom" / "RawRadixSort.cpp").string(), outDir.string());
+        if (checked.succeeded) {
+            std::unique_ptr<Algorithm> plugin(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, checked.libraryPath));
+            VectorDataStructure odd({7, -1, 3, 9, -5});
+            BenchmarkManager isolated;
+            BenchmarkOptions options;
+            options.subprocess = true;
+            isolated.setOptions(options);
+            ExecutionSample sample;
+            {
+                std::ostringstream captured;
+                ScopedStreamRedirect redirect(std::cerr, captured);
+                sample = isolated.sampleExecution(&odd, plugin.get(), 1);
+            }
+            ctx.expect(sample.completed, "The arena layout should pass the alignment sanitizer: " + sample.failure);
+        }
+#endif
+        AlgorithmFactory::cleanupCustomLibraries();
+        std::error_code ec;
+        std::filesystem::remove_all(outDir, ec);
+    });
+
+    suite.add("Plugin registries expose several variants and PluginSweep times them all", [](TestContext& ctx) {
+        const std::filesystem::path root = std::filesystem::absolute(__FILE__).parent_path().parent_path();
+        const std::filesystem::path outDir = std::filesystem::temp_directory_path() / "raystruct_registry_test";
+        std::filesystem::create_directories(outDir);
+
+        // Two registered structures that store the same values in different orders
+        const std::filesystem::path structureSource = outDir / "TwoLists.cpp";
+        {
+            std::ofstream out(structureSource);
+            out << "#include \"" << (root / "include" / "model" / "PluginRegistry.hpp").string() << "\"\n"
+                << "#include <algorithm>\n"
+                << "template <bool Front> struct OrderedList : public DataStructure {\n"
+                << "    std::vector<int> values;\n"
+                << "    void insert(int v) override { Front ? (void)values.insert(values.begin(), v) : values.push_back(v); }\n"
+                << "    void remove(int v) override { values.erase(std::remove(values.begin(), values.end(), v), values.end()); }\n"
+                << "    std::vector<int> getElements() const override { return values; }\n"
+                << "    std::string getName() const override { return Front ? \"Front\" : \"Back\"; }\n"
+                << "};\n"
+                << "template <bool Front> DataStructure* make() { return new OrderedList<Front>(); }\n"
+                << "static const PluginParameter front[] = {{\"order\", \"front\"}};\n"
+                << "static const PluginStructureEntry entries[] = {{\"Front\", &make<true>, front, 1}, {\"Back\", &make<false>, nullptr, 0}};\n"
+                << "static const PluginRegistry registry = {RAYSTRUCT_REGISTRY_VERSION, nullptr, 0, entries, 2};\n"
+                << "extern \"C\" const PluginRegistry* raystructRegistry() { return &registry; }\n";
+        }
+
+        PluginCompiler compiler;
+        PluginBuild algorithms = compiler.compile((root / "custom" / "RadixVariants.cpp").string(), outDir.string());
+        PluginBuild structures = compiler.compile(structureSource.string(), outDir.string());
+        ctx.expect(algorithms.succeeded, "The registry example should compile: " + algorithms.compilerOutput);
+        ctx.expect(structures.succeeded, "The structure registry should compile: " + structures.compilerOutput);
+
+        if (algorithms.succeeded && structures.succeeded) {
+            std::vector<RegisteredEntry> entries;
+            ctx.expect(AlgorithmFactory::listCustomAlgorithms(algorithms.libraryPath, entries), "The registry library should load");
+            ctx.expectEqual(entries.size(), std::size_t(4), "Every registered algorithm should be listed");
+            if (entries.size() == 4) {
+                ctx.expectEqual(entries[2].label(), std::string("Radix Sort 11 (digitBits=11, passes=3)"), "Labels should carry the parameters");
+            }
+
+            std::unique_ptr<Algorithm> chosen(AlgorithmFactory::createCustomAlgorithm(algorithms.libraryPath, "Radix Sort 16"));
+            ctx.expect(chosen && chosen->getName() == "Radix Sort (16-bit digits)", "Entries should be created by name");
+            std::unique_ptr<Algorithm> fallback(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, algorithms.libraryPath));
+            ctx.expect(fallback && fallback->getName() == "Radix Sort (4-bit digits)", "Registry-only libraries should default to the first entry");
+            std::ostringstream errors;
+            {
+                ScopedStreamRedirect redirect(std::cerr, errors);
+                ctx.expect(!AlgorithmFactory::createCustomAlgorithm(algorithms.libraryPath, "Bogo Sort"), "Unknown entries should not be created");
+            }
+
+            std::vector<RegisteredEntry> structureEntries;
+            ctx.expect(DataStructureFactory::listCustomDataStructures(structures.libraryPath, structureEntries) &&
+                           structureEntries.size() == 2, "Registered structures should be listed");
+
+            VectorDataStructure ds({42, -7, 19, 0, 3});
+            BenchmarkManager benchmark;
+            PluginSweep sweep;
+            sweep.setRepetitions(1);
+            std::vector<PluginSweepResult> results;
+            std::ostringstream captured;
+            {
+                ScopedStreamRedirect redirect(std::cout, captured);
+                results = sweep.run(algorithms.libraryPath, &ds, benchmark, structures.libraryPath);
+            }
+            ctx.expectEqual(results.size(), std::size_t(8), "Every algorithm should run on every structure");
+            ctx.expect(std::all_of(results.begin(), results.end(), [](const PluginSweepResult& r) { return r.loaded; }),
+                       "Every pair should load");
+            ctx.expect(std::is_sorted(results.begin(), results.end(), [](const PluginSweepResult& a, const PluginSweepResult& b) {
+                           return a.sample.bestMs < b.sample.bestMs;
+                       }), "Results should be ordered fastest first");
+            ctx.expect(captured.str().find("Front (order=front)") != std::string::npos, "The table should label structures");
+
+            // Pairs of a bandwidth-bound algorithm wait for the concurrent ones and then run alone
+            const unsigned cpu = CoreTopology::detect().cores.front().front();
+            CoreTopology shared;
+            shared.cores = {{cpu}, {cpu}};
+            shared.l3Domains = {{0, 1}};
+            BenchmarkScheduler scheduler(shared);
+            sweep.setScheduler(&scheduler);
+            sweep.setSerialAlgorithms({"Radix Sort 16"});
+            captured.str("");
+            {
+                ScopedStreamRedirect redirect(std::cout, captured);
+                results = sweep.run(algorithms.libraryPath, &ds, benchmark, structures.libraryPath);
+            }
+            ctx.expect(results.size() == 8 && std::all_of(results.begin(), results.end(), [](const PluginSweepResult& r) {
+                           return r.sample.completed;
+                       }), "Every scheduled pair should be timed");
+            ctx.expect(captured.str().find("8 scenario(s): 6 concurrent on 2 slot(s), 2 serial") != std::string::npos,
+                       "Only the named algorithm's pairs should run alone");
+        }
+        AlgorithmFactory::cleanupCustomLibraries();
+        DataStructureFactory::cleanupCustomLibraries();
+        std::error_code ec;
+        std::filesystem::remove_all(outDir, ec);
+    });
+
+    suite.add("PluginWatcher rebuilds, swaps and re-times a plugin after each save", [](TestContext& ctx) {
+        const std::filesystem::path root = std::filesystem::absolute(__FILE__).parent_path().parent_path();
+        const std::filesystem::path workDir = std::filesystem::temp_directory_path() / "raystruct_watch_test";
+        std::filesystem::create_directories(workDir);
+        const std::filesystem::path source = workDir / "WatchedSort.cpp";
+        std::error_code ec;
+        std::filesystem::copy_file(root / "custom" / "RadixSort.cpp", source, std::filesystem::copy_options::overwrite_existing, ec);
+        {
+            // The copy needs the project headers by absolute path
+            std::ifstream in(source);
+            std::stringstream text;
+            text << in.rdbuf();
+            std::string content = text.str();
+            const std::string relative = "../include/";
+            content.replace(content.find(relative), relative.size(), (root / "include").string() + "/");
+            std::ofstream(source) << content;
+        }
+
+        PluginCompiler compiler;
+        PluginWatcher watcher(compiler);
+        watcher.setCacheDirectory((workDir / "cache").string());
+        watcher.setRepetitions(1);
+
+        // A library of the unedited source stays loaded throughout, as it would in a session that skipped the unload
+        PluginCache sessionCache((workDir / "cache").string());
+        PluginBuild sessionBuild = compiler.compile(source.string(), sessionCache);
+        std::unique_ptr<Algorithm> session(AlgorithmFactory::createAlgorithm(AlgorithmEnum::CUSTOM, sessionBuild.libraryPath));
+        ctx.expect(session != nullptr, "The unedited source should build and load");
+
+        // Keep saving edits that rename the algorithm until the watcher has rebuilt once
+        std::string original;
+        {
+            std::ifstream in(source);
+            std::stringstream text;
+            text << in.rdbuf();
+            original = text.str();
+        }
+        std::atomic<bool> done{false};
+        std::thread editor([&]() {
+            for (int edit = 0; !done && edit < 100; ++edit) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(300));
+                std::string content = original;
+                const std::string name = "\"Radix Sort\"";
+                content.replace(content.find(name), name.size(), "\"Radix Sort edit " + std::to_string(edit) + "\"");
+                std::ofstream(source) << content;
+            }
+        });
+
+        VectorDataStructure ds({4, 2, 9, 1});
+        BenchmarkManager benchmark;
+        std::vector<WatchIteration> iterations;
+        std::ostringstream captured;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            iterations = watcher.watch(source.string(), &ds, benchmark, 2);
+        }
+        done = true;
+        editor.join();
+
+        ctx.expectEqual(iterations.size(), std::size_t(2), "The watcher should stop after the requested builds");
+        if (iterations.size() == 2) {
+            ctx.expect(iterations[0].loaded && iterations[1].loaded, "Both builds should load");
+            ctx.expect(iterations[0].build.libraryPath != iterations[1].build.libraryPath, "An edited source should get a new library");
+            ctx.expectEqual(iterations[0].algorithmName, std::string("Radix Sort"), "The first build should run the original code");
+            ctx.expect(iterations[1].algorithmName.rfind("Radix Sort edit ", 0) == 0,
+                       "The rebuilt library should run the edited code, not the one already loaded: " + iterations[1].algorithmName);
+            ctx.expect(AlgorithmFactory::isCustomLibraryLoaded(iterations[0].build.libraryPath), "A library the caller holds should stay loaded");
+            ctx.expect(!AlgorithmFactory::isCustomLibraryLoaded(iterations[1].build.libraryPath), "The last library should be unloaded on return");
+        }
+        ctx.expect(captured.str().find("vs build 1") != std::string::npos, "The second build should be compared with the first");
+
+        session.reset();
+        AlgorithmFactory::cleanupCustomLibraries();
+        std::filesystem::remove_all(workDir, ec);
+    });
+
+    suite.add("BenchmarkOptions parse CPU lists and still run when isolated", [](TestContext& ctx) {
+        std::vector<unsigned> cpus;
+        ctx.expect(BenchmarkOptions::parseCpuList("0,2-4", cpus), "A list with a range should parse");
+        ctx.expect(cpus == std::vector<unsigned>({0, 2, 3, 4}), "Ranges should expand inclusively");
+        ctx.expect(!BenchmarkOptions::parseCpuList("3-1", cpus), "Reversed ranges should be rejected");
+        ctx.expect(!BenchmarkOptions::parseCpuList("a,1", cpus), "Non-numeric entries should be rejected");
+        ctx.expectEqual(cpus.size(), std::size_t(4), "A rejected list should leave the previous one");
+
+        BenchmarkOptions options;
+        ctx.expect(!options.any() && options.describe() == "none", "Isolation should be off by default");
+        options.cpus = {0};
+        options.lockMemory = true;
+        options.prefault = true;
+        ctx.expectEqual(options.describe(), std::string("cpus 0; mlockall; prefault"), "Summary should list each setting");
+
+        BenchmarkManager benchmark;
+        benchmark.setOptions(options);
+        VectorDataStructure ds({5, 1, 4, 2, 3});
+        DummyAlgorithm algo;
+        std::ostringstream captured;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            benchmark.runBenchmark(&ds, &algo);
+        }
+        ctx.expectEqual(algo.getExecuteCount(), 1, "An isolated run should still execute once");
+        ctx.expect(captured.str().find("[Isolation] prefaulted") != std::string::npos, "Prefaulting should be reported");
+
+        // Two CPU entries (the same CPU twice, so it runs anywhere) give parallel runs a two-worker pool,
+        // for the interactive benchmark and for in-process samples alike
+        const unsigned cpu = CoreTopology::detect().cores.front().front();
+        BenchmarkOptions pinned;
+        pinned.cpus = {cpu, cpu};
+        benchmark.setOptions(pinned);
+        PoolProbeAlgorithm probe;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            benchmark.runBenchmark(&ds, &probe);
+        }
+        ctx.expectEqual(probe.getPoolThreads(), 2u, "runBenchmark should use the pinned pool");
+        const ExecutionSample sample = benchmark.sampleExecution(&ds, &probe, 1);
+        ctx.expect(sample.completed && probe.getPoolThreads() == 2u, "sampleExecution should use the same pinned pool");
+    });
+
+    suite.add("Subprocess benchmarks survive crashes and enforce limits", [](TestContext& ctx) {
+        BenchmarkOptions options;
+        options.subprocess = true;
+        options.rssLimitMb = 96;
+        options.cpuLimitSeconds = 1;
+        ctx.expectEqual(options.describe(), std::string("subprocess (cpu 1 s, rss 96 MB)"), "Limits should be listed");
+
+        BenchmarkManager benchmark;
+        benchmark.setOptions(options);
+        VectorDataStructure ds({3, 1, 2});
+
+        DummyAlgorithm dummy;
+        ExecutionSample sample = benchmark.sampleExecution(&ds, &dummy, 3);
+        ctx.expect(sample.completed && sample.runs == 3, "A well-behaved algorithm should finish in the child");
+        ctx.expectEqual(dummy.getExecuteCount(), 0, "The runs should happen in the child's copy");
+        ctx.expect(sample.peakRssKb >= sample.baselineRssKb && sample.baselineRssKb > 0, "The child should report its memory");
+
+        MisbehavingAlgorithm crash(MisbehavingAlgorithm::Mode::CRASH);
+        sample = benchmark.sampleExecution(&ds, &crash, 1);
+        ctx.expect(!sample.completed && sample.failure.find("signal " + std::to_string(SIGSEGV)) != std::string::npos,
+                   "A crash should be reported instead of ending the process: " + sample.failure);
+
+        MisbehavingAlgorithm modest(MisbehavingAlgorithm::Mode::ALLOCATE, 48);
+        sample = benchmark.sampleExecution(&ds, &modest, 1);
+        ctx.expect(sample.completed, "An allocation under the limit should finish: " + sample.failure);
+        ctx.expect(sample.peakRssKb - sample.baselineRssKb >= 40 * 1024, "The peak should include the run's own allocation");
+
+        MisbehavingAlgorithm hog(MisbehavingAlgorithm::Mode::ALLOCATE, 256);
+        sample = benchmark.sampleExecution(&ds, &hog, 1);
+        ctx.expect(!sample.completed && sample.failure.find("RSS limit") != std::string::npos, "The RSS limit should stop the child: " + sample.failure);
+
+        MisbehavingAlgorithm spin(MisbehavingAlgorithm::Mode::SPIN);
+        sample = benchmark.sampleExecution(&ds, &spin, 1);
+        ctx.expect(!sample.completed && sample.failure.find("CPU time limit") != std::string::npos, "The CPU limit should stop the child: " + sample.failure);
+
+        std::ostringstream captured;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            benchmark.runBenchmark(&ds, &crash);
+        }
+        ctx.expect(captured.str().find("Benchmark aborted in the child process") != std::string::npos, "runBenchmark should report the crash");
+    });
+
+    suite.add("Time budgets stop runs and cut off size sweeps", [](TestContext& ctx) {
+        BenchmarkOptions options;
+        options.timeBudgetMs = 150;
+        ctx.expect(options.usesSubprocess(), "A budget should imply the fork");
+        ctx.expectEqual(options.describe(), std::string("subprocess (budget 150 ms)"), "The budget should be listed");
+
+        BenchmarkManager benchmark;
+        benchmark.setOptions(options);
+        VectorDataStructure ds({3, 1, 2});
+        MisbehavingAlgorithm spin(MisbehavingAlgorithm::Mode::SPIN);
+        const auto started = std::chrono::steady_clock::now();
+        const ExecutionSample sample = benchmark.sampleExecution(&ds, &spin, 1);
+        const double waitedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+        ctx.expect(sample.timedOut && !sample.completed, "The watchdog should stop a run that never ends");
+        ctx.expectEqual(sample.failure, std::string("timed out at > 150 ms"), "The timeout should be recorded with the budget");
+        ctx.expect(waitedMs < 2000.0, "The watchdog should not wait much past the budget");
+
+        MisbehavingAlgorithm slowSetUp(MisbehavingAlgorithm::Mode::SLOW_PREPARE);
+        const ExecutionSample prepared = benchmark.sampleExecution(&ds, &slowSetUp, 1);
+        ctx.expect(prepared.completed, "Only the timed runs should count against the budget: " + prepared.failure);
+
+        const std::vector<std::size_t> steps = BenchmarkManager::sizeSweepSteps(30000);
+        ctx.expect(steps == std::vector<std::size_t>({1000, 2000, 5000, 10000, 20000, 30000}), "Sizes should follow 1-2-5 steps");
+
+        // Insertion sort is quadratic and runs out of budget long before the n log n sort does
+        InsertionSort insertion;
+        StdSort stdSort;
+        std::ostringstream captured;
+        std::vector<SizeSweepRow> rows;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            rows = benchmark.runSizeSweep({&insertion, &stdSort}, {400000, 1000, 200000}, 1);
+        }
+        ctx.expectEqual(rows.size(), static_cast<std::size_t>(2), "One row per algorithm");
+        ctx.expectEqual(rows[0].points.size(), static_cast<std::size_t>(3), "One point per size");
+        ctx.expect(rows[0].points[0].sample.completed && rows[0].points[0].elements == 1000, "Sizes should run smallest first");
+        ctx.expect(rows[0].points[1].sample.timedOut, "Insertion sort should time out at 200000 elements");
+        ctx.expect(rows[0].points[2].skipped, "Sizes past the timeout should be skipped");
+        ctx.expectEqual(rows[0].cutoffElements, static_cast<std::size_t>(200000), "The cutoff should be recorded");
+        ctx.expect(rows[1].cutoffElements == 0 && rows[1].points[2].sample.completed, "std::sort should finish every size");
+        ctx.expect(captured.str().find("> 150") != std::string::npos, "The table should show the timeout");
+    });
+
+    suite.add("Scheduler reads core and L3 topology and runs batches side by side", [](TestContext& ctx) {
+        // Eight CPUs: four cores with two hardware threads each (n and n + 4), two cores per L3
+        const std::filesystem::path root = std::filesystem::temp_directory_path() / "raystruct_sysfs_test";
+        std::filesystem::remove_all(root);
+        for (unsigned cpu = 0; cpu < 8; ++cpu) {
+            const unsigned core = cpu % 4;
+            const std::filesystem::path directory = root / ("cpu" + std::to_string(cpu));
+            std::filesystem::create_directories(directory / "topology");
+            std::filesystem::create_directories(directory / "cache" / "index2");
+            std::filesystem::create_directories(directory / "cache" / "index3");
+            std::ofstream(directory / "topology" / "thread_siblings_list") << core << "," << core + 4 << "\n";
+            std::ofstream(directory / "cache" / "index2" / "level") << "2\n";
+            std::ofstream(directory / "cache" / "index2" / "shared_cpu_list") << core << "," << core + 4 << "\n";
+            std::ofstream(directory / "cache" / "index3" / "level") << "3\n";
+            std::ofstream(directory / "cache" / "index3" / "shared_cpu_list") << (core < 2 ? "0-1,4-5" : "2-3,6-7") << "\n";
+        }
+
+        const CoreTopology topology = CoreTopology::fromSysfs(root.string(), {0, 1, 2, 3, 4, 5, 6, 7});
+        std::filesystem::remove_all(root);
+        ctx.expect(topology.cores == std::vector<std::vector<unsigned>>({{0, 4}, {1, 5}, {2, 6}, {3, 7}}),
+                   "SMT siblings should form one core");
+        ctx.expect(topology.l3Domains == std::vector<std::vector<std::size_t>>({{0, 1}, {2, 3}}), "Cores should be grouped by L3");
+
+        BenchmarkScheduler scheduler(topology);
+        ctx.expect(scheduler.slots() == std::vector<std::vector<unsigned>>({{0}, {2}, {1}, {3}}),
+                   "Core slots should alternate between L3 domains");
+        scheduler.setMaxConcurrent(2);
+        ctx.expect(scheduler.slots() == std::vector<std::vector<unsigned>>({{0}, {2}}), "The slot cap should keep one core per domain");
+        scheduler.setMaxConcurrent(0);
+        scheduler.setGranularity(SlotGranularity::L3);
+        ctx.expect(scheduler.slots() == std::vector<std::vector<unsigned>>({{0, 1}, {2, 3}}), "L3 slots should hold whole domains");
+        ctx.expectEqual(BenchmarkScheduler::formatCpus({3, 0, 1, 2, 8}), std::string("0-3,8"), "CPU lists should collapse ranges");
+
+        // Two slots on the first CPU this process may use, so the concurrent path runs on any machine
+        const unsigned cpu = CoreTopology::detect().cores.front().front();
+        CoreTopology shared;
+        shared.cores = {{cpu}, {cpu}};
+        shared.l3Domains = {{0, 1}};
+        BenchmarkScheduler concurrent(shared);
+        VectorDataStructure ds({5, 3, 1, 4, 2});
+        DummyAlgorithm dummy;
+        MisbehavingAlgorithm crash(MisbehavingAlgorithm::Mode::CRASH);
+        StdSort sorter;
+        const std::vector<BenchmarkScenario> scenarios = {
+            {"dummy", &ds, &dummy, 3, false}, {"crash", &ds, &crash, 1, false},
+            {"sort", &ds, &sorter, 2, false}, {"bandwidth", &ds, &sorter, 2, true}};
+
+        std::ostringstream captured;
+        std::vector<ScheduledRun> runs;
+        {
+            ScopedStreamRedirect redirect(std::cout, captured);
+            runs = concurrent.run(scenarios);
+        }
+        ctx.expectEqual(runs.size(), scenarios.size(), "Every scenario should get a result");
+        ctx.expect(runs[0].scenario == "dummy" && runs[0].sample.completed && runs[0].sample.runs == 3, "Results should keep scenario order");
+        ctx.expect(!runs[1].sample.completed, "A crash should only fail its own scenario");
+        ctx.expect(runs[2].sample.completed && !runs[2].serial, "Other scenarios should still finish");
+        ctx.expect(runs[3].serial && runs[3].sample.completed, "Serial scenarios should run on their own");
+        ctx.expect(runs[0].cpus == std::vector<unsigned>({cpu}), "Runs should be pinned to their slot");
+        ctx.expectEqual(dummy.getExecuteCount(), 0, "Scenarios should run in child processes");
+        ctx.expect(captured.str().find("Batch wall time") != std::string::npos, "The batch summary should be printed");
+    });
+
     suite.add("BenchmarkManager invokes algorithm execute", [](TestContext& ctx) {
         BenchmarkManager benchmark;
         VectorDataStructure ds({1, 2, 3});
         DummyAlgorithm algo;
         benchmark.runBenchmark(&ds, &algo);
         ctx.expectEqual(algo.getExecuteCount(), 1, "Benchmark should trigger algorithm exactly once");
+        ctx.expectEqual(algo.getPrepareCount(), 1, "Benchmark should prepare the algorithm exactly once");
     });
 
     return suite.run();